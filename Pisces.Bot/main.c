@@ -0,0 +1,497 @@
+#define LOG_MODULE LOG_MODULE_CLIENT
+
+#include "client.h"
+#include "client_reactor.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+
+// =============================================================================
+// α׷ 
+// =============================================================================
+
+#define PROGRAM_NAME            "Echo Bot"
+#define PROGRAM_VERSION         "1.0.0"
+
+#define DEFAULT_BOT_USERNAME    "pisces-bot"
+#define BOT_POLL_TIMEOUT_MS     500         //  ȣ Ȯ ֱ
+#define MAX_BOT_SESSIONS        CLIENT_REACTOR_DEFAULT_SESSIONS
+#define BOT_PING_COMMAND        "!ping"
+#define BOT_PONG_REPLY          "pong"
+
+#define BOT_CHECK_CHATS         5           // 簳 ˿ ġ  ä 
+#define BOT_CHECK_TIMEOUT_MS    5000        // 簳  ܰ躰  ð
+#define BOT_CHECK_PREFIX        "resume-check"
+
+// =============================================================================
+//  ɼ    ü
+// =============================================================================
+
+typedef struct {
+    int show_help;              //  ǥ
+    char host[MAX_HOSTNAME_LENGTH]; //  ȣƮ
+    uint16_t port;              //  Ʈ
+    char username[MAX_USERNAME_LENGTH]; //  ڸ (   λ)
+    int sessions;               //  Ϳ   
+    int resume_check;           //  簳 ˸ ϰ 
+} bot_args_t;
+
+typedef struct {
+    chat_client_t* client;      //  Ŭ̾Ʈ
+    char username[MAX_USERNAME_LENGTH]; //  ڸ
+    uint32_t chats_seen;        //  ä 
+    uint32_t replies_sent;      //   
+} bot_session_t;
+
+// 簳 ˿  ( äð ū Ŭ̾Ʈ ̺귯  Ģ ó)
+typedef struct {
+    network_socket_t* socket;   //  
+    char username[MAX_USERNAME_LENGTH]; // ڸ
+    char token[SESSION_TOKEN_LENGTH + 1]; //   簳 ū
+    uint32_t last_sequence;     //   ä 
+    int token_received;         //  ῡ ū ޾Ҵ
+    uint32_t echoes;            //  ڱ  ä  
+    uint32_t delivered;         //  ٸ   ä 
+} bot_check_conn_t;
+
+// =============================================================================
+//  
+// =============================================================================
+
+static volatile int g_stop_requested = 0;
+
+// =============================================================================
+// Լ 
+// =============================================================================
+
+static void print_usage(const char* program_name);
+static int parse_arguments(int argc, char* argv[], bot_args_t* args);
+static void bot_signal_handler(int signum);
+static void bot_handle_event(chat_client_t* client, const network_event_t* event, void* user_data);
+static int bot_run_resume_check(const bot_args_t* args);
+static int bot_check_resume(const bot_args_t* args, bot_check_conn_t* listener, bot_check_conn_t* talker);
+static int bot_check_wait(bot_check_conn_t* conn, uint32_t chats);
+static int bot_check_open(const bot_args_t* args, bot_check_conn_t* conn, message_t* request);
+static int bot_check_pump(bot_check_conn_t* conn, int timeout_ms);
+static void bot_check_close(bot_check_conn_t* conn, int graceful);
+
+// =============================================================================
+//  Լ
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    bot_args_t args;
+    if (parse_arguments(argc, argv, &args) != 0) {
+        return EXIT_FAILURE;
+    }
+
+    if (args.show_help) {
+        print_usage(argv[0]);
+        return EXIT_SUCCESS;
+    }
+
+    if (args.resume_check) {
+        return bot_run_resume_check(&args);
+    }
+
+    bot_session_t* sessions = (bot_session_t*)calloc(args.sessions, sizeof(bot_session_t));
+    if (!sessions) {
+        LOG_ERROR("Failed to allocate %d bot sessions", args.sessions);
+        return EXIT_FAILURE;
+    }
+
+    //    ϳ ó
+    client_reactor_t* reactor = client_reactor_create(args.sessions);
+    if (!reactor) {
+        free(sessions);
+        return EXIT_FAILURE;
+    }
+
+    signal(SIGINT, bot_signal_handler);
+
+    int started = 0;
+    for (int i = 0; i < args.sessions && !g_stop_requested; i++) {
+        bot_session_t* session = &sessions[i];
+
+        if (args.sessions == 1) {
+            utils_string_copy(session->username, sizeof(session->username), args.username);
+        }
+        else {
+            sprintf_s(session->username, sizeof(session->username), "%s-%d", args.username, i + 1);
+        }
+
+        client_config_t config = client_get_default_config();
+        utils_string_copy(config.server_host, sizeof(config.server_host), args.host);
+        config.server_port = args.port;
+        utils_string_copy(config.username, sizeof(config.username), session->username);
+        config.history_lines = MIN_HISTORY_LINES;   // ȭ Ƿ ּҰ
+
+        session->client = client_create(&config);
+        if (!session->client) {
+            LOG_ERROR("Failed to create client instance for '%s'", session->username);
+            break;
+        }
+
+        // ȭ  ̺Ʈ ݹ鸸  ( 忡 ȣ)
+        client_set_event_handler(session->client, bot_handle_event, session);
+
+        if (client_reactor_attach(reactor, session->client) != 0 ||
+            client_connect_to_server(session->client, args.host, args.port) != 0) {
+            LOG_ERROR("Failed to start session '%s'", session->username);
+            break;
+        }
+        started++;
+    }
+
+    LOG_INFO("%s running %d session(s) against %s:%d", PROGRAM_NAME, started, args.host, args.port);
+
+    //      ݹ鿡 ó
+    while (!g_stop_requested && started > 0) {
+        Sleep(BOT_POLL_TIMEOUT_MS);
+    }
+
+    uint32_t chats_seen = 0;
+    uint32_t replies_sent = 0;
+
+    for (int i = 0; i < args.sessions; i++) {
+        if (!sessions[i].client) {
+            continue;
+        }
+        client_shutdown(sessions[i].client);
+        chats_seen += sessions[i].chats_seen;
+        replies_sent += sessions[i].replies_sent;
+        client_destroy(sessions[i].client);
+    }
+
+    LOG_INFO("Bot stopping (chats seen: %u, replies sent: %u)", chats_seen, replies_sent);
+
+    client_reactor_destroy(reactor);
+    free(sessions);
+    network_cleanup();
+
+    return EXIT_SUCCESS;
+}
+
+// =============================================================================
+// ̺Ʈ ó
+// =============================================================================
+
+static void bot_handle_event(chat_client_t* client, const network_event_t* event, void* user_data) {
+    bot_session_t* session = (bot_session_t*)user_data;
+
+    switch (event->type) {
+    case NET_EVENT_STATE_CHANGED:
+        LOG_INFO("[%s] State: %s", session->username, client_state_to_string(event->new_state));
+
+        // ó Ǹ  (翬 ̺귯  簳 ó)
+        if (event->new_state == CLIENT_STATE_CONNECTED &&
+            client_get_current_state(client) == CLIENT_STATE_CONNECTED) {
+            client_authenticate(client, session->username);
+        }
+        break;
+
+    case NET_EVENT_CHAT_RECEIVED:
+    {
+        const char* sender = event_string_data(event->username);
+        const char* text = event_string_data(event->message);
+        session->chats_seen++;
+
+        // ڱ ޽ ڿ  
+        if (utils_string_is_empty(sender) || strcmp(sender, session->username) == 0) {
+            break;
+        }
+
+        if (strcmp(text, BOT_PING_COMMAND) == 0) {
+            char reply[MAX_CHAT_MESSAGE_LENGTH];
+            sprintf_s(reply, sizeof(reply), "%s: %s", sender, BOT_PONG_REPLY);
+            if (client_send_chat_message(client, reply) == 0) {
+                session->replies_sent++;
+            }
+        }
+    }
+    break;
+
+    case NET_EVENT_ERROR_OCCURRED:
+        LOG_WARNING("Error: %s", event_string_data(event->message));
+        break;
+
+    default:
+        break;
+    }
+}
+
+static void bot_signal_handler(int signum) {
+    (void)signum;
+    g_stop_requested = 1;
+}
+
+// =============================================================================
+//  簳 
+// =============================================================================
+
+static int bot_run_resume_check(const bot_args_t* args) {
+    if (network_initialize() != NETWORK_SUCCESS) {
+        LOG_ERROR("Failed to initialize network");
+        return EXIT_FAILURE;
+    }
+
+    bot_check_conn_t listener = { 0 };
+    bot_check_conn_t talker = { 0 };
+    sprintf_s(listener.username, sizeof(listener.username), "%s-listener", args->username);
+    sprintf_s(talker.username, sizeof(talker.username), "%s-talker", args->username);
+
+    int passed = bot_check_resume(args, &listener, &talker);
+    if (passed) {
+        LOG_INFO("Resume check passed: %u missed messages delivered", listener.delivered);
+    }
+    else {
+        LOG_ERROR("Resume check failed: %u of %d missed messages delivered", listener.delivered, BOT_CHECK_CHATS);
+    }
+
+    bot_check_close(&listener, 1);
+    bot_check_close(&talker, 1);
+    network_cleanup();
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static int bot_check_resume(const bot_args_t* args, bot_check_conn_t* listener, bot_check_conn_t* talker) {
+    // 1. ûڰ  簳 ū   DISCONNECT   
+    if (bot_check_open(args, listener, message_create_connect_request(listener->username, 0)) != 0 ||
+        bot_check_wait(listener, 0) != 0) {
+        return 0;
+    }
+    bot_check_close(listener, 0);
+    LOG_INFO("'%s' dropped at sequence %u", listener->username, listener->last_sequence);
+
+    // 2. ٸ ڰ ûڰ   ä  ڷ   Ȯ
+    if (bot_check_open(args, talker, message_create_connect_request(talker->username, 0)) != 0 ||
+        bot_check_wait(talker, 0) != 0) {
+        return 0;
+    }
+
+    char payload[MAX_MESSAGE_SIZE - sizeof(message_header_t)];
+    int payload_length = 0;
+    for (uint32_t i = 1; i <= BOT_CHECK_CHATS && payload_length >= 0; i++) {
+        char text[64];
+        sprintf_s(text, sizeof(text), "%s %u", BOT_CHECK_PREFIX, i);
+        payload_length = message_append_chat_record(payload, sizeof(payload), (size_t)payload_length, i, text);
+    }
+
+    message_t* submit = payload_length > 0 ? message_create(MSG_CHAT_SUBMIT, payload, (uint32_t)payload_length) : NULL;
+    network_result_t sent = submit ? network_socket_send_message(talker->socket, submit) : NETWORK_ERROR;
+    message_destroy(submit);
+    if (sent != NETWORK_SUCCESS) {
+        LOG_ERROR("Failed to send check messages as '%s'", talker->username);
+        return 0;
+    }
+
+    if (bot_check_wait(talker, BOT_CHECK_CHATS) != 0) {
+        LOG_ERROR("Server echoed %u of %d check messages", talker->echoes, BOT_CHECK_CHATS);
+        return 0;
+    }
+
+    // 3. ûڰ 簳ϸ ģ ä   ޽ ޾Ƶ鿩 
+    if (bot_check_open(args, listener, message_create_session_resume(listener->username,
+        listener->token, listener->last_sequence, 0)) != 0) {
+        return 0;
+    }
+    bot_check_wait(listener, BOT_CHECK_CHATS);
+
+    return listener->delivered == BOT_CHECK_CHATS;
+}
+
+static int bot_check_wait(bot_check_conn_t* conn, uint32_t chats) {
+    // ū α/簳 ٴ ǥ, chats ٸ ( ) Ǵ   ä 
+    conn->token_received = 0;
+    uint64_t deadline = utils_clock_now_ms() + BOT_CHECK_TIMEOUT_MS;
+
+    while (!conn->token_received || conn->echoes + conn->delivered < chats) {
+        if (utils_clock_now_ms() >= deadline) {
+            LOG_ERROR("Timed out waiting for the server as '%s'", conn->username);
+            return -1;
+        }
+        if (bot_check_pump(conn, BOT_POLL_TIMEOUT_MS) != 0) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static int bot_check_open(const bot_args_t* args, bot_check_conn_t* conn, message_t* request) {
+    conn->socket = network_socket_create(SOCKET_TYPE_TCP_CLIENT);
+    if (!request || !conn->socket ||
+        network_socket_connect(conn->socket, args->host, args->port) != NETWORK_SUCCESS ||
+        network_socket_send_message(conn->socket, request) != NETWORK_SUCCESS) {
+        LOG_ERROR("Failed to log in as '%s' at %s:%d", conn->username, args->host, args->port);
+        message_destroy(request);
+        bot_check_close(conn, 0);
+        return -1;
+    }
+
+    message_destroy(request);
+    return 0;
+}
+
+static int bot_check_pump(bot_check_conn_t* conn, int timeout_ms) {
+    int ready = network_socket_has_data(conn->socket, timeout_ms);
+    if (ready <= 0) {
+        return ready;
+    }
+
+    message_t* msg = network_socket_recv_message(conn->socket);
+    if (!msg) {
+        if (network_socket_is_connected(conn->socket)) {
+            return 0;  //     
+        }
+        LOG_ERROR("Server closed the connection of '%s'", conn->username);
+        return -1;
+    }
+
+    uint16_t msg_type = ntohs(msg->header.type);
+    uint32_t payload_size = ntohl(msg->header.payload_size);
+    int result = 0;
+
+    if (msg_type == MSG_CHAT_BROADCAST && payload_size >= sizeof(chat_message_payload_t)) {
+        chat_message_payload_t* chat = (chat_message_payload_t*)msg->payload;
+        chat->sender_name[MAX_USERNAME_LENGTH - 1] = '\0';
+        chat->message[sizeof(chat->message) - 1] = '\0';
+
+        // Ŭ̾Ʈ  ̹   
+        uint32_t sequence = ntohl(chat->sequence);
+        int accepted = sequence == 0 || sequence > conn->last_sequence;
+        if (sequence > conn->last_sequence) {
+            conn->last_sequence = sequence;
+        }
+
+        if (accepted && strncmp(chat->message, BOT_CHECK_PREFIX, strlen(BOT_CHECK_PREFIX)) == 0) {
+            if (strcmp(chat->sender_name, conn->username) == 0) {
+                conn->echoes++;
+            }
+            else {
+                conn->delivered++;
+            }
+        }
+    }
+    else if (msg_type == MSG_SESSION_TOKEN && payload_size >= sizeof(session_token_payload_t)) {
+        session_token_payload_t* token = (session_token_payload_t*)msg->payload;
+        token->token[SESSION_TOKEN_LENGTH] = '\0';
+        utils_string_copy(conn->token, sizeof(conn->token), token->token);
+
+        uint32_t last_sequence = ntohl(token->last_sequence);
+        if (conn->last_sequence < last_sequence) {
+            conn->last_sequence = last_sequence;
+        }
+        conn->token_received = 1;
+    }
+    else if (IS_ERROR_MSG(msg_type)) {
+        LOG_ERROR("Server rejected '%s' (message type %u)", conn->username, msg_type);
+        result = -1;
+    }
+
+    message_destroy(msg);
+    return result;
+}
+
+static void bot_check_close(bot_check_conn_t* conn, int graceful) {
+    if (!conn->socket) {
+        return;
+    }
+
+    // graceful ƴϸ DISCONNECT     簳   
+    if (graceful) {
+        message_t* bye = message_create(MSG_DISCONNECT, NULL, 0);
+        if (bye) {
+            network_socket_send_message(conn->socket, bye);
+            message_destroy(bye);
+        }
+    }
+
+    network_socket_close(conn->socket);
+    network_socket_destroy(conn->socket);
+    conn->socket = NULL;
+}
+
+// =============================================================================
+//   μ Ľ
+// =============================================================================
+
+static void print_usage(const char* program_name) {
+    printf("%s v%s\n\n", PROGRAM_NAME, PROGRAM_VERSION);
+    printf("Usage: %s [OPTIONS]\n\n", program_name);
+    printf("Headless sample client: replies '%s' to '%s' in the chat.\n\n", BOT_PONG_REPLY, BOT_PING_COMMAND);
+
+    printf("OPTIONS:\n");
+    printf("  -s, --server <host>     Server host (default: %s)\n", DEFAULT_SERVER_HOST);
+    printf("  -p, --port <port>       Server port (default: %d)\n", DEFAULT_SERVER_PORT);
+    printf("  -u, --username <name>   Bot username (default: %s)\n", DEFAULT_BOT_USERNAME);
+    printf("  -n, --sessions <count>  Sessions on one reactor thread, named <name>-1..N (default: 1)\n");
+    printf("      --resume-check      Drop a session, resume it and verify missed messages arrive, then exit\n");
+    printf("  -h, --help              Show this help message\n");
+}
+
+static int parse_arguments(int argc, char* argv[], bot_args_t* args) {
+    memset(args, 0, sizeof(bot_args_t));
+    utils_string_copy(args->host, sizeof(args->host), DEFAULT_SERVER_HOST);
+    args->port = DEFAULT_SERVER_PORT;
+    utils_string_copy(args->username, sizeof(args->username), DEFAULT_BOT_USERNAME);
+    args->sessions = 1;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+
+        if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
+            args->show_help = 1;
+            return 0;
+        }
+        else if (strcmp(arg, "-s") == 0 || strcmp(arg, "--server") == 0) {
+            if (i + 1 >= argc) {
+                LOG_ERROR("Option %s requires a host", arg);
+                return -1;
+            }
+            utils_string_copy(args->host, sizeof(args->host), argv[++i]);
+        }
+        else if (strcmp(arg, "-p") == 0 || strcmp(arg, "--port") == 0) {
+            if (i + 1 >= argc) {
+                LOG_ERROR("Option %s requires a port", arg);
+                return -1;
+            }
+            int port = atoi(argv[++i]);
+            if (port <= 0 || port > 65535) {
+                LOG_ERROR("Invalid port: %s", argv[i]);
+                return -1;
+            }
+            args->port = (uint16_t)port;
+        }
+        else if (strcmp(arg, "-u") == 0 || strcmp(arg, "--username") == 0) {
+            if (i + 1 >= argc) {
+                LOG_ERROR("Option %s requires a username", arg);
+                return -1;
+            }
+            utils_string_copy(args->username, sizeof(args->username), argv[++i]);
+        }
+        else if (strcmp(arg, "-n") == 0 || strcmp(arg, "--sessions") == 0) {
+            if (i + 1 >= argc) {
+                LOG_ERROR("Option %s requires a session count", arg);
+                return -1;
+            }
+            args->sessions = atoi(argv[++i]);
+            if (args->sessions <= 0 || args->sessions > MAX_BOT_SESSIONS) {
+                LOG_ERROR("Session count must be between 1 and %d", MAX_BOT_SESSIONS);
+                return -1;
+            }
+        }
+        else if (strcmp(arg, "--resume-check") == 0) {
+            args->resume_check = 1;
+        }
+        else {
+            LOG_ERROR("Unknown option: %s", arg);
+            LOG_ERROR("Use -h or --help for usage information");
+            return -1;
+        }
+    }
+
+    return 0;
+}
@@ -1,3 +1,5 @@
+#define LOG_MODULE LOG_MODULE_CLIENT
+
 #include "client.h"
 #include "ui.h"
 #include <stdio.h>
@@ -28,6 +30,7 @@ typedef struct {
     int auto_auth;              // ڵ  
     int verbose;                //  α
     int no_colors;              //  Ȱȭ
+    int history_lines;          // ũѹ   (0̸ ⺻)
 } client_args_t;
 
 // =============================================================================
@@ -47,11 +50,23 @@ static int parse_client_arguments(int argc, char* argv[], client_args_t* args);
 static client_config_t create_client_config_from_args(const client_args_t* args);
 static void cleanup_and_exit_client(int exit_code);
 static void client_signal_handler(int signum);
+static void handle_network_event(chat_client_t* client, const network_event_t* event, void* user_data);
+static int handle_frame(chat_client_t* client, void* user_data);
 
 // =============================================================================
 //  Լ
 // =============================================================================
 
+static void handle_network_event(chat_client_t* client, const network_event_t* event, void* user_data) {
+    (void)user_data;
+    client_ui_display_event(client, event);
+}
+
+static int handle_frame(chat_client_t* client, void* user_data) {
+    (void)user_data;
+    return client_ui_render(client);
+}
+
 static int handle_user_input(chat_client_t* client, void* user_data) {
     // ŷ Ű Է üũ
     if (_kbhit()) {
@@ -120,8 +135,10 @@ int main(int argc, char* argv[]) {
         cleanup_and_exit_client(EXIT_FAILURE);
     }
 
-    // Է ڵ鷯 
+    // ܼ UI ݹ 
     client_set_input_handler(g_client, handle_user_input, NULL);
+    client_set_event_handler(g_client, handle_network_event, NULL);
+    client_set_frame_handler(g_client, handle_frame, NULL);
 
     // ڵ  ó
     if (args.auto_connect && !utils_string_is_empty(args.server_host)) {
@@ -155,9 +172,18 @@ int main(int argc, char* argv[]) {
     LOG_INFO("Starting user interface...");
     LOG_INFO("");
 
+    // UI ʱȭ
+    if (client_ui_initialize(g_client) != 0) {
+        LOG_ERROR("Failed to initialize UI");
+        cleanup_and_exit_client(EXIT_FAILURE);
+    }
+
     //  UI  
     int result = client_run(g_client);
 
+    // UI 
+    client_ui_cleanup(g_client);
+
     if (result == 0) {
         LOG_INFO("Client terminated normally");
     }
@@ -186,6 +212,8 @@ static void print_client_usage(const char* program_name) {
     printf("  -a, --auth              Auto-authenticate with username\n");
     printf("  -v, --verbose           Enable verbose logging (DEBUG level)\n");
     printf("  -q, --quiet             Quiet mode (ERROR level only)\n");
+    printf("      --log-module <spec> Per-module log level (e.g. network=debug,server=warn)\n");
+    printf("      --scrollback <lines> Chat history lines to keep (default: %d)\n", DEFAULT_HISTORY_LINES);
     printf("      --no-colors         Disable colored output\n");
     printf("  -h, --help              Show this help message\n");
     printf("      --version           Show version information\n");
@@ -248,6 +276,7 @@ static int parse_client_arguments(int argc, char* argv[], client_args_t* args) {
     args->auto_auth = 0;
     args->verbose = 0;
     args->no_colors = 0;
+    args->history_lines = 0;
 
     for (int i = 1; i < argc; i++) {
         const char* arg = argv[i];
@@ -324,6 +353,35 @@ static int parse_client_arguments(int argc, char* argv[], client_args_t* args) {
             args->verbose = -1;  //   ǥ
         }
 
+        // ⺰ α 
+        else if (strcmp(arg, "--log-module") == 0) {
+            if (i + 1 >= argc) {
+                LOG_ERROR("Option %s requires a module=level list", arg);
+                return -1;
+            }
+
+            if (utils_parse_module_log_levels(argv[++i]) != 0) {
+                LOG_ERROR("Invalid module log level spec: %s", argv[i]);
+                LOG_ERROR("Modules: general, network, message, server, client / Levels: debug, info, warn, error, crit");
+                return -1;
+            }
+        }
+
+        // ũѹ ũ
+        else if (strcmp(arg, "--scrollback") == 0) {
+            if (i + 1 >= argc) {
+                LOG_ERROR("Option %s requires a line count", arg);
+                return -1;
+            }
+
+            args->history_lines = atoi(argv[++i]);
+            if (args->history_lines < MIN_HISTORY_LINES || args->history_lines > MAX_HISTORY_LINES) {
+                LOG_ERROR("Invalid scrollback: %d (must be %d-%d)",
+                    args->history_lines, MIN_HISTORY_LINES, MAX_HISTORY_LINES);
+                return -1;
+            }
+        }
+
         //  Ȱȭ
         else if (strcmp(arg, "--no-colors") == 0) {
             args->no_colors = 1;
@@ -387,6 +445,10 @@ static client_config_t create_client_config_from_args(const client_args_t* args)
         config.log_level = LOG_LEVEL_ERROR;
     }
 
+    if (args->history_lines > 0) {
+        config.history_lines = args->history_lines;
+    }
+
     // ڵ 翬 ⺻ Ȱȭ (ٿ Ȱȭ ɼ )
     config.auto_reconnect = 1;
 
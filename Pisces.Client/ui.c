@@ -1,3 +1,5 @@
+#define LOG_MODULE LOG_MODULE_CLIENT
+
 #include "ui.h"
 #include <stdlib.h>
 #include <string.h>
@@ -34,7 +36,7 @@ int client_ui_initialize(chat_client_t* client) {
     }
 
     // UI  
-    g_ui_state = ui_state_create();
+    g_ui_state = ui_state_create(client->config.history_lines);
     if (!g_ui_state) {
         LOG_ERROR("Failed to create UI state");
         return -1;
@@ -53,6 +55,7 @@ int client_ui_initialize(chat_client_t* client) {
 
     // ȭ ʱȭ
     ui_clear_screen();
+    ui_invalidate_screen(g_ui_state);
     ui_show_welcome_message(client);
     ui_refresh_screen(client, g_ui_state);
 
@@ -87,12 +90,17 @@ void client_ui_cleanup(chat_client_t* client) {
     LOG_INFO("Console UI cleaned up");
 }
 
-ui_state_t* ui_state_create(void) {
+ui_state_t* ui_state_create(int history_lines) {
     ui_state_t* ui_state = (ui_state_t*)calloc(1, sizeof(ui_state_t));
     if (!ui_state) {
         return NULL;
     }
 
+    if (chat_history_init(&ui_state->history, history_lines) != 0) {
+        free(ui_state);
+        return NULL;
+    }
+
     // ܼ ũ 
     ui_get_console_size(&ui_state->console_width, &ui_state->console_height);
 
@@ -106,8 +114,7 @@ ui_state_t* ui_state_create(void) {
     ui_state->input_pos = 0;
     ui_state->input_active = 1;
 
-    // 丮 ʱȭ
-    ui_state->history_count = 0;
+    // ũ ʱȭ ( Ʒ)
     ui_state->history_scroll = 0;
 
     //  ʱȭ
@@ -119,6 +126,9 @@ ui_state_t* ui_state_create(void) {
 
 void ui_state_destroy(ui_state_t* ui_state) {
     if (ui_state) {
+        chat_history_free(&ui_state->history);
+        free(ui_state->back_buffer);
+        free(ui_state->front_buffer);
         free(ui_state);
     }
 }
@@ -127,6 +137,129 @@ void ui_state_destroy(ui_state_t* ui_state) {
 // ȭ  Լ
 // =============================================================================
 
+static int ui_resize_buffers(ui_state_t* ui_state, int width, int height) {
+    size_t cells = (size_t)width * height;
+    CHAR_INFO* back_buffer = (CHAR_INFO*)malloc(cells * sizeof(CHAR_INFO));
+    CHAR_INFO* front_buffer = (CHAR_INFO*)malloc(cells * sizeof(CHAR_INFO));
+    if (!back_buffer || !front_buffer) {
+        LOG_ERROR("Failed to allocate screen buffers (%dx%d)", width, height);
+        free(back_buffer);
+        free(front_buffer);
+        return -1;
+    }
+
+    free(ui_state->back_buffer);
+    free(ui_state->front_buffer);
+    ui_state->back_buffer = back_buffer;
+    ui_state->front_buffer = front_buffer;
+    ui_state->buffer_width = width;
+    ui_state->buffer_height = height;
+
+    // ̾ƿ 
+    ui_state->console_width = width;
+    ui_state->console_height = height;
+    ui_state->chat_area_height = height - 4;  //  , Է , 
+    ui_state->status_line = height - 3;
+    ui_state->input_line = height - 1;
+
+    ui_invalidate_screen(ui_state);
+    return 0;
+}
+
+static void ui_buffer_fill_row(ui_state_t* ui_state, int row, char ch, int color) {
+    if (row < 0 || row >= ui_state->buffer_height) {
+        return;
+    }
+
+    // ä ڴ 1Ʈ̹Ƿ Ӽ  2Ʈ  ǥõ Բ 
+    CHAR_INFO* cells = ui_state->back_buffer + (size_t)row * ui_state->buffer_width;
+    for (int col = 0; col < ui_state->buffer_width; col++) {
+        cells[col].Char.AsciiChar = ch;
+        cells[col].Attributes = (WORD)color;
+    }
+}
+
+static void ui_buffer_put_text(ui_state_t* ui_state, int row, int col, const char* text, int color) {
+    if (row < 0 || row >= ui_state->buffer_height || !text) {
+        return;
+    }
+
+    // DBCS ڵ (CP949 ) 2Ʈ ڴ  ĭ   / Ʈ ǥؾ
+    // WriteConsoleOutputA  ڷ 
+    UINT code_page = GetConsoleOutputCP();
+    int width = ui_state->buffer_width;
+    CHAR_INFO* cells = ui_state->back_buffer + (size_t)row * width;
+
+    //  2Ʈ   ݺ     
+    if (col > 0 && col < width && (cells[col].Attributes & COMMON_LVB_TRAILING_BYTE)) {
+        cells[col - 1].Char.AsciiChar = ' ';
+        cells[col - 1].Attributes &= (WORD)~COMMON_LVB_LEADING_BYTE;
+    }
+
+    while (*text && col < width) {
+        if (IsDBCSLeadByteEx(code_page, (BYTE)*text)) {
+            // ¦   Ʈ   ģ ڴ   ĭ ǥ
+            if (text[1] == '\0' || col + 1 >= width) {
+                cells[col].Char.AsciiChar = ' ';
+                cells[col].Attributes = (WORD)color;
+                col++;
+                break;
+            }
+
+            cells[col].Char.AsciiChar = text[0];
+            cells[col].Attributes = (WORD)(color | COMMON_LVB_LEADING_BYTE);
+            cells[col + 1].Char.AsciiChar = text[1];
+            cells[col + 1].Attributes = (WORD)(color | COMMON_LVB_TRAILING_BYTE);
+            text += 2;
+            col += 2;
+            continue;
+        }
+
+        cells[col].Char.AsciiChar = *text;
+        cells[col].Attributes = (WORD)color;
+        text++;
+        col++;
+    }
+
+    //  ڸ  2Ʈ   ̸ Բ 
+    if (col < width && (cells[col].Attributes & COMMON_LVB_TRAILING_BYTE)) {
+        cells[col].Char.AsciiChar = ' ';
+        cells[col].Attributes &= (WORD)~COMMON_LVB_TRAILING_BYTE;
+    }
+}
+
+static void ui_flush_frame(ui_state_t* ui_state) {
+    int width = ui_state->buffer_width;
+    size_t row_bytes = (size_t)width * sizeof(CHAR_INFO);
+    int first_dirty = -1;
+    int last_dirty = -1;
+
+    //  Ӱ ޶   ã
+    for (int row = 0; row < ui_state->buffer_height; row++) {
+        size_t offset = (size_t)row * width;
+        if (memcmp(ui_state->back_buffer + offset, ui_state->front_buffer + offset, row_bytes) != 0) {
+            if (first_dirty < 0) {
+                first_dirty = row;
+            }
+            last_dirty = row;
+        }
+    }
+
+    if (first_dirty >= 0 && g_console_handle != INVALID_HANDLE_VALUE) {
+        // ޶     ȣ 
+        COORD buffer_size = { (SHORT)width, (SHORT)ui_state->buffer_height };
+        COORD buffer_origin = { 0, (SHORT)first_dirty };
+        SMALL_RECT region = { 0, (SHORT)first_dirty, (SHORT)(width - 1), (SHORT)last_dirty };
+
+        if (WriteConsoleOutputA(g_console_handle, ui_state->back_buffer,
+            buffer_size, buffer_origin, &region)) {
+            size_t offset = (size_t)first_dirty * width;
+            memcpy(ui_state->front_buffer + offset, ui_state->back_buffer + offset,
+                (size_t)(last_dirty - first_dirty + 1) * row_bytes);
+        }
+    }
+}
+
 void ui_refresh_screen(chat_client_t* client, ui_state_t* ui_state) {
     if (!client || !ui_state) {
         return;
@@ -137,53 +270,84 @@ void ui_refresh_screen(chat_client_t* client, ui_state_t* ui_state) {
         return;
     }
 
+    //    (      )
+    ULONGLONG now = GetTickCount64();
+    if (now - ui_state->last_frame_tick < UI_REFRESH_INTERVAL_MS) {
+        return;
+    }
+
+    // ܼ ũⰡ ٲ ۿ ̾ƿ 籸
+    int width, height;
+    ui_get_console_size(&width, &height);
+    if (width != ui_state->buffer_width || height != ui_state->buffer_height || !ui_state->back_buffer) {
+        if (ui_resize_buffers(ui_state, width, height) != 0) {
+            return;
+        }
+    }
+
     ui_draw_chat_area(client, ui_state);
     ui_draw_status_line(client, ui_state);
     ui_draw_input_line(client, ui_state);
+    ui_flush_frame(ui_state);
+
+    // Ŀ Է ġ
+    int cursor_x = (int)strlen(INPUT_PROMPT) + ui_state->input_pos;
+    if (cursor_x >= ui_state->buffer_width) {
+        cursor_x = ui_state->buffer_width - 1;
+    }
+    ui_set_cursor_position(cursor_x, ui_state->input_line);
 
     ui_state->need_refresh = 0;
+    ui_state->last_frame_tick = now;
     ui_state->last_update = time(NULL);
 }
 
+void ui_invalidate_screen(ui_state_t* ui_state) {
+    if (!ui_state) {
+        return;
+    }
+
+    //  ¿  ʴ  ä   ٸ ̵ 
+    if (ui_state->front_buffer) {
+        memset(ui_state->front_buffer, 0xFF,
+            (size_t)ui_state->buffer_width * ui_state->buffer_height * sizeof(CHAR_INFO));
+    }
+    ui_state->need_refresh = 1;
+}
+
 void ui_draw_chat_area(chat_client_t* client, ui_state_t* ui_state) {
-    if (!client || !ui_state) {
+    if (!client || !ui_state || !ui_state->back_buffer) {
         return;
     }
 
-    // ä  
-    for (int line = 0; line < ui_state->chat_area_height; line++) {
-        ui_set_cursor_position(0, line);
-        for (int col = 0; col < ui_state->console_width; col++) {
-            printf(" ");
-        }
+    // ä  Ʒ  
+    for (int line = 0; line < ui_state->status_line; line++) {
+        ui_buffer_fill_row(ui_state, line, ' ', COLOR_RESET);
     }
 
-    // ä 丮 
-    int start_line = (ui_state->history_count > ui_state->chat_area_height) ?
-        ui_state->history_count - ui_state->chat_area_height : 0;
+    // ä 丮  (ũ ġ   ε)
+    int history_count = ui_state->history.count;
+    int end_line = history_count - ui_state->history_scroll;
+    int start_line = end_line - ui_state->chat_area_height;
+    if (start_line < 0) {
+        start_line = 0;
+    }
 
-    for (int i = 0; i < ui_state->chat_area_height && start_line + i < ui_state->history_count; i++) {
-        ui_set_cursor_position(0, i);
-        printf("%s", ui_state->chat_history[start_line + i]);
+    for (int i = 0; start_line + i < end_line; i++) {
+        int color = COLOR_RESET;
+        const char* line = chat_history_get(&ui_state->history, start_line + i, &color);
+        ui_buffer_put_text(ui_state, i, 0, line, color);
     }
 }
 
 void ui_draw_status_line(chat_client_t* client, ui_state_t* ui_state) {
-    if (!client || !ui_state) {
+    if (!client || !ui_state || !ui_state->back_buffer) {
         return;
     }
 
-    //   ġ ̵
-    ui_set_cursor_position(0, ui_state->status_line);
-
-    // м 
-    ui_set_console_color(COLOR_SYSTEM);
-    for (int i = 0; i < ui_state->console_width; i++) {
-        printf("-");
-    }
-
-    //   
-    ui_set_cursor_position(0, ui_state->status_line);
+    // м
+    ui_buffer_fill_row(ui_state, ui_state->status_line, '-', COLOR_SYSTEM);
+    ui_buffer_fill_row(ui_state, ui_state->status_line + 1, ' ', COLOR_RESET);
 
     client_state_t state = client_get_current_state(client);
     const char* state_str = client_state_to_string(state);
@@ -191,17 +355,17 @@ void ui_draw_status_line(chat_client_t* client, ui_state_t* ui_state) {
     char status_text[256];
     if (client_is_authenticated(client)) {
         sprintf_s(status_text, sizeof(status_text),
-            "Connected as '%s' | %s | Type /help for commands",
+            " Connected as '%s' | %s | Type /help for commands",
             client->config.username, state_str);
     }
     else if (client_is_connected(client)) {
         sprintf_s(status_text, sizeof(status_text),
-            "Connected to %s:%d | %s | Authenticating...",
+            " Connected to %s:%d | %s | Authenticating...",
             client->config.server_host, client->config.server_port, state_str);
     }
     else {
         sprintf_s(status_text, sizeof(status_text),
-            "Not connected | %s | Type /connect <host> <port> to start",
+            " Not connected | %s | Type /connect <host> <port> to start",
             state_str);
     }
 
@@ -215,31 +379,19 @@ void ui_draw_status_line(chat_client_t* client, ui_state_t* ui_state) {
     default: color = COLOR_INFO; break;
     }
 
-    ui_set_console_color(color);
-    printf(" %s", status_text);
+    ui_buffer_put_text(ui_state, ui_state->status_line, 0, status_text, color);
 }
 
 void ui_draw_input_line(chat_client_t* client, ui_state_t* ui_state) {
-    if (!client || !ui_state) {
+    if (!client || !ui_state || !ui_state->back_buffer) {
         return;
     }
 
-    // Է  ġ ̵
-    ui_set_cursor_position(0, ui_state->input_line);
-
-    // Է  
-    ui_set_console_color(COLOR_RESET);
-    for (int i = 0; i < ui_state->console_width; i++) {
-        printf(" ");
-    }
-
-    // Ʈ Է  
-    ui_set_cursor_position(0, ui_state->input_line);
-    ui_set_console_color(COLOR_RESET);
-    printf("%s%s", INPUT_PROMPT, ui_state->input_buffer);
-
-    // Ŀ ġ 
-    ui_set_cursor_position(strlen(INPUT_PROMPT) + ui_state->input_pos, ui_state->input_line);
+    // Ʈ Է 
+    ui_buffer_fill_row(ui_state, ui_state->input_line, ' ', COLOR_RESET);
+    ui_buffer_put_text(ui_state, ui_state->input_line, 0, INPUT_PROMPT, COLOR_RESET);
+    ui_buffer_put_text(ui_state, ui_state->input_line, (int)strlen(INPUT_PROMPT),
+        ui_state->input_buffer, COLOR_RESET);
 }
 
 void ui_show_help(chat_client_t* client) {
@@ -253,7 +405,9 @@ void ui_show_help(chat_client_t* client) {
     ui_add_system_message(g_ui_state, "/disconnect - Disconnect from server", COLOR_INFO);
     ui_add_system_message(g_ui_state, "/users - Show online users", COLOR_INFO);
     ui_add_system_message(g_ui_state, "/status - Show client status", COLOR_INFO);
+    ui_add_system_message(g_ui_state, "/stats - Show traffic statistics and RTT", COLOR_INFO);
     ui_add_system_message(g_ui_state, "/clear - Clear chat history", COLOR_INFO);
+    ui_add_system_message(g_ui_state, "/scroll [up|down|top|bottom] - Scroll chat history", COLOR_INFO);
     ui_add_system_message(g_ui_state, "/quit - Exit client", COLOR_INFO);
     ui_add_system_message(g_ui_state, "/help - Show this help", COLOR_INFO);
     ui_add_system_message(g_ui_state, "", COLOR_RESET);
@@ -465,14 +619,59 @@ int ui_process_command(chat_client_t* client, const char* command) {
     if (strcmp(cmd, "status") == 0 || strcmp(cmd, "info") == 0) {
         client_print_status(client);
         ui_add_system_message(g_ui_state, "Status printed to console", COLOR_INFO);
-        if (g_ui_state) g_ui_state->need_refresh = 1;
+        ui_invalidate_screen(g_ui_state);
+        return 0;
+    }
+
+    if (strcmp(cmd, "stats") == 0) {
+        client_print_statistics(client);
+        ui_add_system_message(g_ui_state, "Statistics printed to console", COLOR_INFO);
+        ui_invalidate_screen(g_ui_state);
+        return 0;
+    }
+
+    if (strcmp(cmd, "scroll") == 0) {
+        char* direction = strtok(NULL, " ");
+
+        if (g_ui_state) {
+            int page = g_ui_state->chat_area_height > 1 ? g_ui_state->chat_area_height - 1 : 1;
+            int max_scroll = g_ui_state->history.count - g_ui_state->chat_area_height;
+            if (max_scroll < 0) {
+                max_scroll = 0;
+            }
+
+            if (!direction || strcmp(direction, "up") == 0) {
+                g_ui_state->history_scroll += page;
+            }
+            else if (strcmp(direction, "down") == 0) {
+                g_ui_state->history_scroll -= page;
+            }
+            else if (strcmp(direction, "top") == 0) {
+                g_ui_state->history_scroll = max_scroll;
+            }
+            else if (strcmp(direction, "bottom") == 0 || strcmp(direction, "end") == 0) {
+                g_ui_state->history_scroll = 0;
+            }
+            else {
+                ui_add_system_message(g_ui_state, "Usage: /scroll [up|down|top|bottom]", COLOR_ERROR);
+            }
+
+            if (g_ui_state->history_scroll > max_scroll) {
+                g_ui_state->history_scroll = max_scroll;
+            }
+            if (g_ui_state->history_scroll < 0) {
+                g_ui_state->history_scroll = 0;
+            }
+            g_ui_state->need_refresh = 1;
+        }
         return 0;
     }
 
     if (strcmp(cmd, "clear") == 0 || strcmp(cmd, "cls") == 0) {
         // ä 丮 
         if (g_ui_state) {
-            g_ui_state->history_count = 0;
+            chat_history_clear(&g_ui_state->history);
+            g_ui_state->history_scroll = 0;
             g_ui_state->need_refresh = 1;
         }
         ui_add_system_message(g_ui_state, "Chat history cleared", COLOR_SYSTEM);
@@ -492,6 +691,44 @@ int ui_process_command(chat_client_t* client, const char* command) {
 // ̺Ʈ ǥ Լ
 // =============================================================================
 
+static void ui_add_user_list(ui_state_t* ui_state, const char* timestamp_str, const char* user_list) {
+    //   KB   Ƿ 丮  ٿ  ŭ ڸ   ǥ
+    char line[CHAT_HISTORY_LINE_LENGTH];
+    int prefix_length = _snprintf_s(line, sizeof(line), _TRUNCATE, "[%s] Online users: ", timestamp_str);
+    size_t indent = prefix_length > 0 ? (size_t)prefix_length : 0;
+    size_t length = indent;
+    int names_on_line = 0;
+
+    const char* cursor = user_list;
+    while (*cursor) {
+        const char* separator = strchr(cursor, ',');
+        size_t name_length = separator ? (size_t)(separator - cursor) : strlen(cursor);
+
+        if (names_on_line > 0 && length + 1 + name_length >= sizeof(line)) {
+            line[length] = '\0';
+            ui_add_system_message(ui_state, line, COLOR_INFO);
+            memset(line, ' ', indent);
+            length = indent;
+            names_on_line = 0;
+        }
+
+        if (names_on_line > 0) {
+            line[length++] = ',';
+        }
+        if (name_length > sizeof(line) - 1 - length) {
+            name_length = sizeof(line) - 1 - length;
+        }
+        memcpy(line + length, cursor, name_length);
+        length += name_length;
+        names_on_line++;
+
+        cursor = separator ? separator + 1 : cursor + strlen(cursor);
+    }
+
+    line[length] = '\0';
+    ui_add_system_message(ui_state, line, COLOR_INFO);
+}
+
 void client_ui_display_event(chat_client_t* client, const network_event_t* event) {
     if (!client || !event || !g_ui_state) {
         return;
@@ -504,40 +741,35 @@ void client_ui_display_event(chat_client_t* client, const network_event_t* event
     case NET_EVENT_STATE_CHANGED:
     {
         char state_msg[256];
-        sprintf_s(state_msg, sizeof(state_msg), "[%s] %s", timestamp_str, event->message);
+        _snprintf_s(state_msg, sizeof(state_msg), _TRUNCATE, "[%s] %s", timestamp_str, event_string_data(event->message));
         ui_add_system_message(g_ui_state, state_msg, COLOR_SYSTEM);
     }
     break;
 
     case NET_EVENT_CHAT_RECEIVED:
     {
-        if (!utils_string_is_empty(event->username)) {
-            ui_add_chat_message(g_ui_state, event->username, event->message,
-                event->timestamp, COLOR_CHAT);
+        if (!utils_string_is_empty(event_string_data(event->username))) {
+            ui_add_chat_message(g_ui_state, event_string_data(event->username),
+                event_string_data(event->message), event->timestamp, COLOR_CHAT);
         }
         else {
             // ý ä ޽
-            char chat_msg[512];
-            sprintf_s(chat_msg, sizeof(chat_msg), "[%s] %s", timestamp_str, event->message);
+            char chat_msg[CHAT_HISTORY_LINE_LENGTH];
+            _snprintf_s(chat_msg, sizeof(chat_msg), _TRUNCATE, "[%s] %s", timestamp_str, event_string_data(event->message));
             ui_add_system_message(g_ui_state, chat_msg, COLOR_SYSTEM);
         }
     }
     break;
 
     case NET_EVENT_USER_LIST_RECEIVED:
-    {
-        char list_msg[512];
-        sprintf_s(list_msg, sizeof(list_msg), "[%s] Online users: %s",
-            timestamp_str, event->message);
-        ui_add_system_message(g_ui_state, list_msg, COLOR_INFO);
-    }
-    break;
+        ui_add_user_list(g_ui_state, timestamp_str, event_string_data(event->message));
+        break;
 
     case NET_EVENT_USER_JOINED:
     {
         char join_msg[256];
-        sprintf_s(join_msg, sizeof(join_msg), "[%s] %s joined the chat",
-            timestamp_str, event->username);
+        _snprintf_s(join_msg, sizeof(join_msg), _TRUNCATE, "[%s] %s joined the chat",
+            timestamp_str, event_string_data(event->username));
         ui_add_system_message(g_ui_state, join_msg, COLOR_SUCCESS);
     }
     break;
@@ -545,26 +777,26 @@ void client_ui_display_event(chat_client_t* client, const network_event_t* event
     case NET_EVENT_USER_LEFT:
     {
         char leave_msg[256];
-        sprintf_s(leave_msg, sizeof(leave_msg), "[%s] %s left the chat",
-            timestamp_str, event->username);
+        _snprintf_s(leave_msg, sizeof(leave_msg), _TRUNCATE, "[%s] %s left the chat",
+            timestamp_str, event_string_data(event->username));
         ui_add_system_message(g_ui_state, leave_msg, COLOR_SYSTEM);
     }
     break;
 
     case NET_EVENT_ERROR_OCCURRED:
     {
-        char error_msg[512];
-        sprintf_s(error_msg, sizeof(error_msg), "[%s] Error: %s",
-            timestamp_str, event->message);
+        char error_msg[CHAT_HISTORY_LINE_LENGTH];
+        _snprintf_s(error_msg, sizeof(error_msg), _TRUNCATE, "[%s] Error: %s",
+            timestamp_str, event_string_data(event->message));
         ui_add_system_message(g_ui_state, error_msg, COLOR_ERROR);
     }
     break;
 
     case NET_EVENT_CONNECTION_STATUS:
     {
-        char status_msg[512];
-        sprintf_s(status_msg, sizeof(status_msg), "[%s] %s",
-            timestamp_str, event->message);
+        char status_msg[CHAT_HISTORY_LINE_LENGTH];
+        _snprintf_s(status_msg, sizeof(status_msg), _TRUNCATE, "[%s] %s",
+            timestamp_str, event_string_data(event->message));
 
         int color = COLOR_INFO;
         if (event->new_state == CLIENT_STATE_AUTHENTICATED) {
@@ -587,6 +819,33 @@ void client_ui_display_event(chat_client_t* client, const network_event_t* event
     g_ui_state->need_refresh = 1;
 }
 
+int client_ui_render(chat_client_t* client) {
+    if (!client || !g_ui_state) {
+        return -1;
+    }
+
+    ui_refresh_screen(client, g_ui_state);
+    if (!g_ui_state->need_refresh) {
+        return -1;
+    }
+
+    ULONGLONG elapsed = GetTickCount64() - g_ui_state->last_frame_tick;
+    return elapsed >= UI_REFRESH_INTERVAL_MS ? 0 : (int)(UI_REFRESH_INTERVAL_MS - elapsed);
+}
+
+static void ui_history_push(ui_state_t* ui_state, const char* text, int color) {
+    chat_history_append(&ui_state->history, text, color);
+
+    //  ũ ¸  ִ  ״ ̵ 
+    if (ui_state->history_scroll > 0) {
+        int max_scroll = ui_state->history.count - ui_state->chat_area_height;
+        ui_state->history_scroll++;
+        if (ui_state->history_scroll > max_scroll) {
+            ui_state->history_scroll = max_scroll > 0 ? max_scroll : 0;
+        }
+    }
+}
+
 void ui_add_chat_message(ui_state_t* ui_state, const char* username,
     const char* message, time_t timestamp, int color) {
     if (!ui_state || utils_string_is_empty(message)) {
@@ -596,32 +855,19 @@ void ui_add_chat_message(ui_state_t* ui_state, const char* username,
     char timestamp_buf[32];
     const char* timestamp_str = ui_format_timestamp(timestamp, timestamp_buf, sizeof(timestamp_buf));
 
-    char formatted_message[512];
+    // ä  丮  ٺ   Ƿ ߶ 
+    char formatted_message[CHAT_HISTORY_LINE_LENGTH];
     if (username && !utils_string_is_empty(username)) {
-        sprintf_s(formatted_message, sizeof(formatted_message),
+        _snprintf_s(formatted_message, sizeof(formatted_message), _TRUNCATE,
             "[%s] <%s> %s", timestamp_str, username, message);
     }
     else {
-        sprintf_s(formatted_message, sizeof(formatted_message),
+        _snprintf_s(formatted_message, sizeof(formatted_message), _TRUNCATE,
             "[%s] %s", timestamp_str, message);
     }
 
     // 丮 ߰
-    if (ui_state->history_count < CHAT_HISTORY_SIZE) {
-        utils_string_copy(ui_state->chat_history[ui_state->history_count],
-            sizeof(ui_state->chat_history[0]), formatted_message);
-        ui_state->history_count++;
-    }
-    else {
-        // 丮      
-        for (int i = 0; i < CHAT_HISTORY_SIZE - 1; i++) {
-            utils_string_copy(ui_state->chat_history[i],
-                sizeof(ui_state->chat_history[0]),
-                ui_state->chat_history[i + 1]);
-        }
-        utils_string_copy(ui_state->chat_history[CHAT_HISTORY_SIZE - 1],
-            sizeof(ui_state->chat_history[0]), formatted_message);
-    }
+    ui_history_push(ui_state, formatted_message, color);
 
     ui_state->need_refresh = 1;
 }
@@ -632,23 +878,146 @@ void ui_add_system_message(ui_state_t* ui_state, const char* message, int color)
     }
 
     // ý ޽ Ÿӽ  ߰
-    if (ui_state->history_count < CHAT_HISTORY_SIZE) {
-        utils_string_copy(ui_state->chat_history[ui_state->history_count],
-            sizeof(ui_state->chat_history[0]), message);
-        ui_state->history_count++;
+    ui_history_push(ui_state, message, color);
+
+    ui_state->need_refresh = 1;
+}
+
+// =============================================================================
+// ä 丮
+// =============================================================================
+
+int chat_history_init(chat_history_t* history, int lines) {
+    if (!history || lines <= 0) {
+        return -1;
+    }
+
+    memset(history, 0, sizeof(chat_history_t));
+
+    //   ̷ Ʒ ũ⸦ ϵ    ׻  
+    uint64_t arena_size = (uint64_t)lines * CHAT_HISTORY_AVG_LINE_BYTES;
+    if (arena_size < CHAT_HISTORY_LINE_LENGTH * 4) {
+        arena_size = CHAT_HISTORY_LINE_LENGTH * 4;
+    }
+
+    history->entries = (history_entry_t*)malloc((size_t)lines * sizeof(history_entry_t));
+    history->arena = (char*)malloc((size_t)arena_size);
+    if (!history->entries || !history->arena) {
+        LOG_ERROR("Failed to allocate chat history (%d lines, %llu bytes)", lines, arena_size);
+        free(history->entries);
+        free(history->arena);
+        memset(history, 0, sizeof(chat_history_t));
+        return -1;
+    }
+
+    history->capacity = lines;
+    history->arena_size = (uint32_t)arena_size;
+    return 0;
+}
+
+void chat_history_free(chat_history_t* history) {
+    if (!history) {
+        return;
+    }
+
+    free(history->entries);
+    free(history->arena);
+    memset(history, 0, sizeof(chat_history_t));
+}
+
+static void chat_history_evict_oldest(chat_history_t* history) {
+    history->head = (history->head + 1) % history->capacity;
+    history->count--;
+
+    if (history->count == 0) {
+        history->head = 0;
+        history->arena_head = 0;
+        history->arena_tail = 0;
     }
     else {
-        // 丮      
-        for (int i = 0; i < CHAT_HISTORY_SIZE - 1; i++) {
-            utils_string_copy(ui_state->chat_history[i],
-                sizeof(ui_state->chat_history[0]),
-                ui_state->chat_history[i + 1]);
+        history->arena_head = history->entries[history->head].offset;
+    }
+}
+
+void chat_history_append(chat_history_t* history, const char* text, int color) {
+    if (!history || !history->entries || !text) {
+        return;
+    }
+
+    size_t length = strlen(text);
+    if (length > CHAT_HISTORY_LINE_LENGTH - 1) {
+        length = CHAT_HISTORY_LINE_LENGTH - 1;
+    }
+    uint32_t needed = (uint32_t)length + 1;
+
+    if (history->count == history->capacity) {
+        chat_history_evict_oldest(history);
+    }
+
+    // ڿ Ʒ  ʰ :  ڸ   ,
+    // ׷ ϸ   ٺ о
+    uint32_t position;
+    for (;;) {
+        if (history->count == 0) {
+            position = 0;
+            break;
+        }
+
+        if (history->arena_tail > history->arena_head) {
+            if (history->arena_size - history->arena_tail >= needed) {
+                position = history->arena_tail;
+                break;
+            }
+            if (history->arena_head >= needed) {
+                position = 0;
+                break;
+            }
+        }
+        else if (history->arena_head - history->arena_tail >= needed) {
+            position = history->arena_tail;
+            break;
         }
-        utils_string_copy(ui_state->chat_history[CHAT_HISTORY_SIZE - 1],
-            sizeof(ui_state->chat_history[0]), message);
+
+        chat_history_evict_oldest(history);
     }
 
-    ui_state->need_refresh = 1;
+    memcpy(history->arena + position, text, length);
+    history->arena[position + length] = '\0';
+
+    int index = (history->head + history->count) % history->capacity;
+    history->entries[index].offset = position;
+    history->entries[index].length = (uint16_t)length;
+    history->entries[index].color = (uint16_t)color;
+
+    if (history->count == 0) {
+        history->arena_head = position;
+    }
+    history->arena_tail = position + needed;
+    history->count++;
+}
+
+void chat_history_clear(chat_history_t* history) {
+    if (!history) {
+        return;
+    }
+
+    history->head = 0;
+    history->count = 0;
+    history->arena_head = 0;
+    history->arena_tail = 0;
+}
+
+const char* chat_history_get(const chat_history_t* history, int index, int* color) {
+    if (!history || index < 0 || index >= history->count) {
+        return NULL;
+    }
+
+    const history_entry_t* entry = &history->entries[(history->head + index) % history->capacity];
+    if (color) {
+        *color = entry->color;
+    }
+
+    return history->arena + entry->offset;
 }
 
 // =============================================================================
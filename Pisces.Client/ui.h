@@ -10,8 +10,9 @@
 // =============================================================================
 
 #define MAX_INPUT_LENGTH        512         // ִ Է 
-#define UI_REFRESH_INTERVAL_MS  50          // UI ΰħ 
-#define CHAT_HISTORY_SIZE       100         // ä 丮 ũ
+#define UI_REFRESH_INTERVAL_MS  50          // UI ΰħ  (ּ  )
+#define CHAT_HISTORY_LINE_LENGTH 512        // 丮   ִ 
+#define CHAT_HISTORY_AVG_LINE_BYTES 128     // Ʒ ũ    
 #define INPUT_PROMPT           "> "         // Է Ʈ
 #define COMMAND_PREFIX         "/"          // ɾ λ
 
@@ -28,6 +29,29 @@
 #define COLOR_USERNAME         0x0D         // ڸ (ȫ)
 #define COLOR_TIMESTAMP        0x08         // Ÿӽ (ȸ)
 
+// =============================================================================
+// ä 丮 (  ׸  + Ʈ Ʒ)
+// =============================================================================
+
+// 丮 ׸ (ڿ Ʒ NUL   )
+typedef struct {
+    uint32_t offset;                        // Ʒ   ġ
+    uint16_t length;                        // ڿ  (NUL )
+    uint16_t color;                         // ǥ 
+} history_entry_t;
+
+typedef struct {
+    history_entry_t* entries;               // ׸ 
+    int capacity;                           // ִ ׸() 
+    int head;                               //   ׸ ε
+    int count;                              //  ׸ 
+
+    char* arena;                            // ڿ Ʈ 
+    uint32_t arena_size;                    // Ʒ ũ
+    uint32_t arena_head;                    //   ڿ ġ
+    uint32_t arena_tail;                    //   ġ
+} chat_history_t;
+
 // =============================================================================
 // UI  ü
 // =============================================================================
@@ -45,9 +69,15 @@ typedef struct {
     int input_line;                         // Է  ġ
 
     // ä 丮
-    char chat_history[CHAT_HISTORY_SIZE][512];  // ä 丮
-    int history_count;                      // 丮 
-    int history_scroll;                     // ũ ġ
+    chat_history_t history;                 // ä 丮 
+    int history_scroll;                     // ũ ġ ( Ʒ ö  )
+
+    // ȭ  ( Ӱ ޶ ุ ֿܼ )
+    CHAR_INFO* back_buffer;                 // ̹ ӿ  ȭ
+    CHAR_INFO* front_buffer;                // ֿܼ µ ȭ
+    int buffer_width;                       //  ʺ
+    int buffer_height;                      //  
+    ULONGLONG last_frame_tick;              //    ð (ms)
 
     //  
     time_t last_update;                     //  Ʈ ð
@@ -73,9 +103,10 @@ void client_ui_cleanup(chat_client_t* client);
 
 /**
  * UI  ʱȭ
+ * @param history_lines ũѹ  
  * @return  UI ,   NULL
  */
-ui_state_t* ui_state_create(void);
+ui_state_t* ui_state_create(int history_lines);
 
 /**
  * UI  
@@ -88,28 +119,35 @@ void ui_state_destroy(ui_state_t* ui_state);
 // =============================================================================
 
 /**
- * ü ȭ ΰħ
+ * ȭ ΰħ (  ְ     )
+ *  ۿ ȭ    Ӱ ޶     
  * @param client Ŭ̾Ʈ νϽ
  * @param ui_state UI 
  */
 void ui_refresh_screen(chat_client_t* client, ui_state_t* ui_state);
 
 /**
- * ä  
+ * ֿܼ µ     Ǿ   ӿ ü ٽ 
+ * @param ui_state UI 
+ */
+void ui_invalidate_screen(ui_state_t* ui_state);
+
+/**
+ * ä   ( )
  * @param client Ŭ̾Ʈ νϽ
  * @param ui_state UI 
  */
 void ui_draw_chat_area(chat_client_t* client, ui_state_t* ui_state);
 
 /**
- *   
+ *    ( )
  * @param client Ŭ̾Ʈ νϽ
  * @param ui_state UI 
  */
 void ui_draw_status_line(chat_client_t* client, ui_state_t* ui_state);
 
 /**
- * Է  
+ * Է   ( )
  * @param client Ŭ̾Ʈ νϽ
  * @param ui_state UI 
  */
@@ -175,6 +213,13 @@ int ui_process_command(chat_client_t* client, const char* command);
  */
 void client_ui_display_event(chat_client_t* client, const network_event_t* event);
 
+/**
+ *   ȭ   (  )
+ * @param client Ŭ̾Ʈ νϽ
+ * @return  ̷  ӱ  ms,     -1
+ */
+int client_ui_render(chat_client_t* client);
+
 /**
  * ä ޽ ߰
  * @param ui_state UI 
@@ -194,6 +239,47 @@ void ui_add_chat_message(ui_state_t* ui_state, const char* username,
  */
 void ui_add_system_message(ui_state_t* ui_state, const char* message, int color);
 
+// =============================================================================
+// ä 丮 Լ
+// =============================================================================
+
+/**
+ * 丮  Ҵ
+ * @param history 丮
+ * @param lines ִ  
+ * @return   0,   -1
+ */
+int chat_history_init(chat_history_t* history, int lines);
+
+/**
+ * 丮  
+ * @param history 丮
+ */
+void chat_history_free(chat_history_t* history);
+
+/**
+ * 丮   ߰ (O(1),  ϸ  ٺ )
+ * @param history 丮
+ * @param text ߰ ڿ (CHAT_HISTORY_LINE_LENGTH  ߸)
+ * @param color ǥ 
+ */
+void chat_history_append(chat_history_t* history, const char* text, int color);
+
+/**
+ * 丮 
+ * @param history 丮
+ */
+void chat_history_clear(chat_history_t* history);
+
+/**
+ * 丮 ׸ ȸ (0   )
+ * @param history 丮
+ * @param index ׸ ε
+ * @param color ǥ  (, NULL )
+ * @return ڿ,   NULL
+ */
+const char* chat_history_get(const chat_history_t* history, int index, int* color);
+
 // =============================================================================
 // ƿƼ Լ
 // =============================================================================
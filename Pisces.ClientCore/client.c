@@ -1,7 +1,19 @@
+#define LOG_MODULE LOG_MODULE_CLIENT
+
 #include "client.h"
+#include "client_reactor.h"
+#include <stdarg.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 
+// =============================================================================
+//   Լ 
+// =============================================================================
+
+static int client_post_command(chat_client_t* client, const ui_command_t* command);
+static int client_emit_event(chat_client_t* client, const network_event_t* event);
+
 // =============================================================================
 //   ƿƼ Լ - Part 1
 // =============================================================================
@@ -23,11 +35,14 @@ client_config_t client_get_default_config(void) {
     // UI 
     config.show_timestamps = 1;                 // Ÿӽ ǥ
     config.show_system_messages = 1;            // ý ޽ ǥ
+    config.history_lines = DEFAULT_HISTORY_LINES;
     config.log_level = LOG_LEVEL_INFO;
 
     //  
     config.message_queue_size = MAX_MESSAGE_QUEUE_SIZE;
     config.network_buffer_size = NETWORK_BUFFER_SIZE;
+    config.enable_compression = 1;              // ä  κ  ̶  ȿ ŭ
+    config.enable_compact_header = 1;
 
     return config;
 }
@@ -75,6 +90,13 @@ int client_validate_config(const client_config_t* config) {
         return 0;
     }
 
+    // ũѹ ũ Ȯ
+    if (config->history_lines < MIN_HISTORY_LINES || config->history_lines > MAX_HISTORY_LINES) {
+        LOG_ERROR("Invalid history lines: %d (must be %d-%d)",
+            config->history_lines, MIN_HISTORY_LINES, MAX_HISTORY_LINES);
+        return 0;
+    }
+
     LOG_DEBUG("Client configuration validated successfully");
     return 1;
 }
@@ -128,6 +150,12 @@ chat_client_t* client_create(const client_config_t* config) {
     client->network_thread = NULL;
     client->ui_thread = GetCurrentThread();  //  
 
+    // Ǻ Ʈũ   ʱȭ
+    client->socket_event = WSA_INVALID_EVENT;
+    client->bound_socket = INVALID_SOCKET;
+    client->reactor = NULL;
+    client->reactor_slot = -1;
+
     // ȭ ü ʱȭ
     InitializeCriticalSection(&client->state_lock);
 
@@ -171,7 +199,7 @@ chat_client_t* client_create(const client_config_t* config) {
     }
 
     //   ʱȭ
-    client->last_heartbeat = time(NULL);
+    client->last_heartbeat = utils_clock_now_ms();
     client->connection_start_time = 0;
     utils_string_copy(client->last_error, sizeof(client->last_error), "");
 
@@ -199,11 +227,17 @@ void client_destroy(chat_client_t* client) {
     LOG_INFO("Destroying client instance...");
 
     // Ŭ̾Ʈ   ̸ 
-    if (client->current_state != CLIENT_STATE_DISCONNECTED) {
+    if (client->current_state != CLIENT_STATE_DISCONNECTED || client->reactor) {
         LOG_WARNING("Client still active, forcing shutdown...");
         client_shutdown(client);
     }
 
+    // Ͱ   ϰ   
+    if (client->reactor) {
+        LOG_ERROR("Client is still attached to a reactor, leaking instance");
+        return;
+    }
+
     //   
     if (client->server_socket) {
         network_socket_close(client->server_socket);
@@ -267,6 +301,7 @@ int client_change_state(chat_client_t* client, client_state_t new_state, client_
     case CLIENT_STATE_CONNECTING:
         if (new_state != CLIENT_STATE_CONNECTED &&
             new_state != CLIENT_STATE_DISCONNECTED &&
+            new_state != CLIENT_STATE_RECONNECTING &&
             new_state != CLIENT_STATE_ERROR) {
             valid_transition = 0;
         }
@@ -275,6 +310,7 @@ int client_change_state(chat_client_t* client, client_state_t new_state, client_
     case CLIENT_STATE_CONNECTED:
         if (new_state != CLIENT_STATE_AUTHENTICATING &&
             new_state != CLIENT_STATE_DISCONNECTING &&
+            new_state != CLIENT_STATE_RECONNECTING &&
             new_state != CLIENT_STATE_ERROR) {
             valid_transition = 0;
         }
@@ -283,6 +319,7 @@ int client_change_state(chat_client_t* client, client_state_t new_state, client_
     case CLIENT_STATE_AUTHENTICATING:
         if (new_state != CLIENT_STATE_AUTHENTICATED &&
             new_state != CLIENT_STATE_DISCONNECTING &&
+            new_state != CLIENT_STATE_RECONNECTING &&
             new_state != CLIENT_STATE_ERROR) {
             valid_transition = 0;
         }
@@ -321,16 +358,20 @@ int client_change_state(chat_client_t* client, client_state_t new_state, client_
         client_event_to_string(event));
 
     // UI 忡   ˸
+    if (!client->event_queue) {
+        return 0;
+    }
+
     network_event_t state_event = { 0 };
     state_event.type = NET_EVENT_STATE_CHANGED;
     state_event.new_state = new_state;
     state_event.timestamp = time(NULL);
-    sprintf_s(state_event.message, sizeof(state_event.message),
+    state_event.message = event_string_format(&client->event_queue->strings,
         "State changed from %s to %s",
         client_state_to_string(old_state),
         client_state_to_string(new_state));
 
-    event_queue_push(client->event_queue, &state_event);
+    client_emit_event(client, &state_event);
 
     return 0;
 }
@@ -445,8 +486,8 @@ void client_print_status(const chat_client_t* client) {
     printf("Auto reconnect: %s\n", client->config.auto_reconnect ? "Enabled" : "Disabled");
 
     if (client->connection_start_time > 0) {
-        time_t uptime = time(NULL) - client->connection_start_time;
-        printf("Connection uptime: %d seconds\n", (int)uptime);
+        uint64_t uptime_ms = utils_clock_elapsed_ms(client->connection_start_time, utils_clock_now_ms());
+        printf("Connection uptime: %d seconds\n", (int)(uptime_ms / 1000));
     }
 
     char error_buffer[256];
@@ -478,6 +519,14 @@ void client_print_statistics(const chat_client_t* client) {
     printf("Reconnect count: %u\n", stats->reconnect_count);
     printf("Connection failures: %u\n", stats->connection_failures);
 
+    if (stats->rtt.samples > 0) {
+        printf("RTT: %.2f ms (smoothed %.2f ms, variance %.2f ms, %u samples)\n",
+            stats->rtt.last_ms, stats->rtt.srtt_ms, stats->rtt.rttvar_ms, stats->rtt.samples);
+    }
+    else {
+        printf("RTT: no samples yet\n");
+    }
+
     if (stats->connected_at > 0) {
         char connected_time[TIME_STRING_SIZE];
         utils_time_to_string(stats->connected_at, connected_time, sizeof(connected_time));
@@ -501,6 +550,11 @@ int client_start(chat_client_t* client) {
         return -1;
     }
 
+    if (client->reactor) {
+        LOG_ERROR("Client is attached to a reactor");
+        return -1;
+    }
+
     client_state_t current_state = client_get_current_state(client);
     if (current_state != CLIENT_STATE_DISCONNECTED) {
         LOG_ERROR("Client is not in disconnected state (current: %s)",
@@ -555,6 +609,14 @@ int client_shutdown(chat_client_t* client) {
     client->should_shutdown = 1;
     SetEvent(client->shutdown_event);
 
+    //   Ϳ  (  尡 )
+    if (client->reactor) {
+        if (client_reactor_detach(client->reactor, client) != 0) {
+            LOG_WARNING("Failed to detach client from reactor");
+            return -1;
+        }
+    }
+
     // Ʈũ    (ִ 10)
     if (client->network_thread) {
         DWORD wait_result = WaitForSingleObject(client->network_thread, 10000);
@@ -609,66 +671,241 @@ int client_run(chat_client_t* client) {
 
     LOG_INFO("Client main loop started");
 
-    // UI ʱȭ
-    if (client_ui_initialize(client) != 0) {
-        LOG_ERROR("Failed to initialize UI");
-        return -1;
-    }
+    int event_timeout_ms = CLIENT_UI_POLL_MS;
 
     //  
     while (!client->should_shutdown) {
-        // Ʈũ ̺Ʈ ó
-        network_event_t event;
-        int event_result = event_queue_pop(client->event_queue, &event, 100);
+        // Ʈũ ̺Ʈ ó ( ̺Ʈ      )
+        client_poll(client, event_timeout_ms);
 
-        if (event_result == 0) {
-            client_ui_display_event(client, &event);
+        //  Է ó
+        if (client->input_handler) {
+            int input_result = client->input_handler(client, client->input_handler_data);
+            if (input_result < 0) {
+                LOG_WARNING("Input handler returned error, continuing...");
+            }
         }
-        else if (event_result == -2) {
-            // ŸӾƿ -  Ȳ
+
+        // ȭ   (̷   ð  )
+        int next_frame_ms = -1;
+        if (client->frame_handler) {
+            next_frame_ms = client->frame_handler(client, client->frame_handler_data);
+        }
+
+        if (next_frame_ms >= 0 && next_frame_ms < CLIENT_UI_POLL_MS) {
+            event_timeout_ms = next_frame_ms > 0 ? next_frame_ms : 1;
         }
         else {
-            Sleep(10);
+            event_timeout_ms = CLIENT_UI_POLL_MS;
         }
 
-        //  Է ó - ݹ ȣ ( ߰)
-        if (client->input_handler) {
-            int input_result = client->input_handler(client, client->input_handler_data);
-            if (input_result < 0) {
-                LOG_WARNING("Input handler returned error, continuing...");
-                // Է  ־   (û)
+        // CPU  event_queue_pop ŷ  
+    }
+
+    LOG_INFO("Client main loop exiting");
+    return 0;
+}
+
+int client_poll(chat_client_t* client, int timeout_ms) {
+    if (!client || !client->event_queue) {
+        return -1;
+    }
+
+    int dispatched = 0;
+    network_event_t event;
+
+    if (event_queue_pop(client->event_queue, &event, timeout_ms) == 0) {
+        do {
+            if (client->event_handler) {
+                client->event_handler(client, &event, client->event_handler_data);
             }
+            network_event_release(&event);
+            dispatched++;
+        } while (dispatched < CLIENT_POLL_EVENT_BATCH &&
+            event_queue_pop(client->event_queue, &event, 0) == 0);
+    }
+
+    // ֱ ƮƮ ŸӾƿ üũ (1ʸ,    Ÿ̸Ӱ )
+    // last_heartbeat Ʈũ 尡 ڱ ð ϹǷ   ð   
+    uint64_t now_ms = utils_clock_update();
+    if (!client->reactor && now_ms - client->last_status_check >= 1000) {
+        if (client_is_connected(client) &&
+            utils_clock_elapsed_ms(client->last_heartbeat, now_ms) > (uint64_t)client->config.heartbeat_timeout * 1000) {
+            LOG_WARNING("Heartbeat timeout detected");
+            client_set_last_error(client, "Heartbeat timeout");
+
+            //  ٿ   Ḧ ˸ ʾ  簳  
+            ui_command_t disconnect_cmd = { 0 };
+            disconnect_cmd.type = UI_CMD_DISCONNECT;
+            utils_string_copy(disconnect_cmd.data, sizeof(disconnect_cmd.data), "Heartbeat timeout");
+            client_post_command(client, &disconnect_cmd);
         }
+        client->last_status_check = now_ms;
+    }
 
-        // ֱ  üũ ( )
-        static time_t last_status_check = 0;
-        time_t current_time = time(NULL);
+    return dispatched;
+}
 
-        if (current_time - last_status_check >= 1) {
-            if (client_is_connected(client)) {
-                if (current_time - client->last_heartbeat > client->config.heartbeat_timeout) {
-                    LOG_WARNING("Heartbeat timeout detected");
-                    client_set_last_error(client, "Heartbeat timeout");
+// =============================================================================
+//  Һ   ť (command/event ť )
+// =============================================================================
 
-                    ui_command_t disconnect_cmd = { 0 };
-                    disconnect_cmd.type = UI_CMD_DISCONNECT;
-                    command_queue_push(client->command_queue, &disconnect_cmd);
-                }
+static LONG ring_load_acquire(volatile LONG* ptr) {
+    LONG value = *ptr;
+    MemoryBarrier();
+    return value;
+}
+
+static void ring_store_release(volatile LONG* ptr, LONG value) {
+    MemoryBarrier();
+    *ptr = value;
+}
+
+static int ring_queue_init(ring_queue_t* ring, size_t element_size, int capacity) {
+    // ε  ũ ϱ  2 ŵ ø
+    LONG rounded = 1;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+
+    ring->slots = (char*)calloc(rounded, element_size);
+    ring->sequences = (volatile LONG*)calloc(rounded, sizeof(LONG));
+    ring->not_empty_event = CreateEvent(NULL, FALSE, FALSE, NULL);
+
+    if (!ring->slots || !ring->sequences || !ring->not_empty_event) {
+        free(ring->slots);
+        free((void*)ring->sequences);
+        if (ring->not_empty_event) {
+            CloseHandle(ring->not_empty_event);
+        }
+        return -1;
+    }
+
+    for (LONG i = 0; i < rounded; i++) {
+        ring->sequences[i] = i;
+    }
+
+    ring->element_size = (LONG)element_size;
+    ring->capacity = rounded;
+    ring->mask = rounded - 1;
+    ring->enqueue_pos = 0;
+    ring->dequeue_pos = 0;
+    ring->consumer_waiting = 0;
+    ring->dropped = 0;
+
+    return 0;
+}
+
+static void ring_queue_destroy(ring_queue_t* ring) {
+    if (ring->not_empty_event) {
+        CloseHandle(ring->not_empty_event);
+        ring->not_empty_event = NULL;
+    }
+
+    free(ring->slots);
+    free((void*)ring->sequences);
+    ring->slots = NULL;
+    ring->sequences = NULL;
+}
+
+static int ring_queue_push(ring_queue_t* ring, const void* element) {
+    LONG pos = ring_load_acquire(&ring->enqueue_pos);
+    LONG index;
+
+    //   CAS  Ȯ ( ڰ ϳ  )
+    for (;;) {
+        index = pos & ring->mask;
+        LONG sequence = ring_load_acquire(&ring->sequences[index]);
+        LONG diff = (LONG)((ULONG)sequence - (ULONG)pos);
+
+        if (diff == 0) {
+            LONG next = (LONG)((ULONG)pos + 1);
+            if (InterlockedCompareExchange(&ring->enqueue_pos, next, pos) == pos) {
+                break;
             }
-            last_status_check = current_time;
+            pos = ring_load_acquire(&ring->enqueue_pos);
+        }
+        else if (diff < 0) {
+            return -1;  // ť 
+        }
+        else {
+            pos = ring_load_acquire(&ring->enqueue_pos);
         }
+    }
+
+    memcpy(ring->slots + (size_t)index * ring->element_size, element, ring->element_size);
+    ring_store_release(&ring->sequences[index], (LONG)((ULONG)pos + 1));
+
+    // Һڰ     (  ý ȣ )
+    MemoryBarrier();
+    if (ring->consumer_waiting) {
+        SetEvent(ring->not_empty_event);
+    }
+
+    return 0;
+}
 
-        // CPU  
-        Sleep(10);
+static int ring_queue_try_pop(ring_queue_t* ring, void* element) {
+    LONG pos = ring->dequeue_pos;
+    LONG index = pos & ring->mask;
+    LONG sequence = ring_load_acquire(&ring->sequences[index]);
+
+    if ((LONG)((ULONG)sequence - ((ULONG)pos + 1)) != 0) {
+        return -1;  //  (Ǵ ڰ   )
     }
 
-    // UI 
-    client_ui_cleanup(client);
+    memcpy(element, ring->slots + (size_t)index * ring->element_size, ring->element_size);
+    ring_store_release(&ring->sequences[index], (LONG)((ULONG)pos + ring->capacity));
+    ring->dequeue_pos = (LONG)((ULONG)pos + 1);
 
-    LOG_INFO("Client main loop exiting");
     return 0;
 }
 
+static int ring_queue_pop(ring_queue_t* ring, void* element, int timeout_ms) {
+    if (ring_queue_try_pop(ring, element) == 0) {
+        return 0;
+    }
+
+    if (timeout_ms == 0) {
+        return -1;  //  ȯ
+    }
+
+    ULONGLONG deadline = GetTickCount64() + (ULONGLONG)timeout_ms;
+
+    for (;;) {
+        //  ǥ  ٽ Ȯؾ   ȣ ġ 
+        InterlockedExchange(&ring->consumer_waiting, 1);
+
+        if (ring_queue_try_pop(ring, element) == 0) {
+            InterlockedExchange(&ring->consumer_waiting, 0);
+            return 0;
+        }
+
+        ULONGLONG now = GetTickCount64();
+        if (now >= deadline) {
+            InterlockedExchange(&ring->consumer_waiting, 0);
+            return -2;  // ŸӾƿ
+        }
+
+        WaitForSingleObject(ring->not_empty_event, (DWORD)(deadline - now));
+        InterlockedExchange(&ring->consumer_waiting, 0);
+
+        if (ring_queue_try_pop(ring, element) == 0) {
+            return 0;
+        }
+    }
+}
+
+static int ring_queue_has_item(ring_queue_t* ring) {
+    LONG pos = ring->dequeue_pos;
+    LONG sequence = ring_load_acquire(&ring->sequences[pos & ring->mask]);
+    return (LONG)((ULONG)sequence - ((ULONG)pos + 1)) == 0;
+}
+
+static int ring_queue_count(ring_queue_t* ring) {
+    return (int)((ULONG)ring->enqueue_pos - (ULONG)ring->dequeue_pos);
+}
+
 // =============================================================================
 // ť  Լ - Command Queue
 // =============================================================================
@@ -685,21 +922,13 @@ command_queue_t* command_queue_create(int capacity) {
         return NULL;
     }
 
-    queue->commands = (ui_command_t*)calloc(capacity, sizeof(ui_command_t));
-    if (!queue->commands) {
-        LOG_ERROR("Failed to allocate memory for command queue array");
+    if (ring_queue_init(&queue->ring, sizeof(ui_command_t), capacity) != 0) {
+        LOG_ERROR("Failed to allocate command queue ring");
         free(queue);
         return NULL;
     }
 
-    queue->capacity = capacity;
-    queue->size = 0;
-    queue->front = 0;
-    queue->rear = 0;
-
-    InitializeCriticalSection(&queue->lock);
-
-    LOG_DEBUG("Created command queue with capacity %d", capacity);
+    LOG_DEBUG("Created command queue with capacity %d", queue->ring.capacity);
     return queue;
 }
 
@@ -708,11 +937,7 @@ void command_queue_destroy(command_queue_t* queue) {
         return;
     }
 
-    DeleteCriticalSection(&queue->lock);
-
-    if (queue->commands) {
-        free(queue->commands);
-    }
+    ring_queue_destroy(&queue->ring);
 
     free(queue);
     LOG_DEBUG("Command queue destroyed");
@@ -723,23 +948,13 @@ int command_queue_push(command_queue_t* queue, const ui_command_t* command) {
         return -1;
     }
 
-    EnterCriticalSection(&queue->lock);
-
-    // ť   Ȯ
-    if (queue->size >= queue->capacity) {
-        LeaveCriticalSection(&queue->lock);
+    if (ring_queue_push(&queue->ring, command) != 0) {
+        InterlockedIncrement(&queue->ring.dropped);
         LOG_DEBUG("Command queue is full");
         return -1;  // ť 
     }
 
-    //  ߰
-    queue->commands[queue->rear] = *command;
-    queue->rear = (queue->rear + 1) % queue->capacity;
-    queue->size++;
-
-    LeaveCriticalSection(&queue->lock);
-
-    LOG_DEBUG("Command pushed to queue (type: %d, size: %d)", command->type, queue->size);
+    LOG_DEBUG("Command pushed to queue (type: %d, size: %d)", command->type, ring_queue_count(&queue->ring));
     return 0;
 }
 
@@ -748,34 +963,190 @@ int command_queue_pop(command_queue_t* queue, ui_command_t* command, int timeout
         return -1;
     }
 
-    time_t start_time = time(NULL);
-    time_t end_time = start_time + (timeout_ms / 1000);
+    int result = ring_queue_pop(&queue->ring, command, timeout_ms);
+    if (result == 0) {
+        LOG_DEBUG("Command popped from queue (type: %d, size: %d)", command->type, ring_queue_count(&queue->ring));
+    }
 
-    while (time(NULL) <= end_time || timeout_ms == 0) {
-        EnterCriticalSection(&queue->lock);
+    return result;  // ť (-1) Ǵ ŸӾƿ(-2)
+}
 
-        if (queue->size > 0) {
-            //  
-            *command = queue->commands[queue->front];
-            queue->front = (queue->front + 1) % queue->capacity;
-            queue->size--;
+HANDLE command_queue_begin_wait(command_queue_t* queue) {
+    if (!queue) {
+        return NULL;
+    }
 
-            LeaveCriticalSection(&queue->lock);
+    //  ǥ  ٽ Ȯ (ring_queue_pop  )
+    InterlockedExchange(&queue->ring.consumer_waiting, 1);
+    if (ring_queue_has_item(&queue->ring)) {
+        return NULL;
+    }
 
-            LOG_DEBUG("Command popped from queue (type: %d, size: %d)", command->type, queue->size);
-            return 0;
+    return queue->ring.not_empty_event;
+}
+
+void command_queue_end_wait(command_queue_t* queue) {
+    if (queue) {
+        InterlockedExchange(&queue->ring.consumer_waiting, 0);
+    }
+}
+
+// =============================================================================
+// ̺Ʈ ڿ Ǯ
+// =============================================================================
+
+static size_t event_string_class_size(int size_class) {
+    return (size_t)EVENT_STRING_MIN_CLASS_SIZE << (2 * size_class);
+}
+
+static void event_string_pool_init(event_string_pool_t* pool) {
+    for (int i = 0; i < EVENT_STRING_CLASS_COUNT; i++) {
+        InitializeSListHead(&pool->free_lists[i]);
+        pool->cached[i] = 0;
+    }
+    pool->live_count = 0;
+}
+
+static void event_string_pool_destroy(event_string_pool_t* pool) {
+    if (pool->live_count != 0) {
+        LOG_WARNING("Event string pool destroyed with %ld strings still referenced", pool->live_count);
+    }
+
+    for (int i = 0; i < EVENT_STRING_CLASS_COUNT; i++) {
+        PSLIST_ENTRY entry;
+        while ((entry = InterlockedPopEntrySList(&pool->free_lists[i])) != NULL) {
+            _aligned_free(entry);
         }
+        pool->cached[i] = 0;
+    }
+}
+
+static event_string_t* event_string_alloc(event_string_pool_t* pool, size_t length) {
+    if (!pool) {
+        return NULL;
+    }
+
+    // ڿ (NUL )     
+    int size_class = -1;
+    for (int i = 0; i < EVENT_STRING_CLASS_COUNT; i++) {
+        if (length + 1 <= event_string_class_size(i)) {
+            size_class = i;
+            break;
+        }
+    }
+
+    event_string_t* str = NULL;
+    if (size_class >= 0) {
+        PSLIST_ENTRY entry = InterlockedPopEntrySList(&pool->free_lists[size_class]);
+        if (entry) {
+            InterlockedDecrement(&pool->cached[size_class]);
+            str = (event_string_t*)entry;
+        }
+        else {
+            str = (event_string_t*)_aligned_malloc(
+                offsetof(event_string_t, data) + event_string_class_size(size_class),
+                MEMORY_ALLOCATION_ALIGNMENT);
+        }
+    }
+    else {
+        str = (event_string_t*)_aligned_malloc(
+            offsetof(event_string_t, data) + length + 1, MEMORY_ALLOCATION_ALIGNMENT);
+    }
+
+    if (!str) {
+        LOG_ERROR("Failed to allocate event string (%zu bytes)", length + 1);
+        return NULL;
+    }
+
+    str->pool = pool;
+    str->ref_count = 1;
+    str->size_class = size_class;
+    str->length = (uint32_t)length;
+    str->data[length] = '\0';
+
+    InterlockedIncrement(&pool->live_count);
+    return str;
+}
+
+event_string_t* event_string_create(event_string_pool_t* pool, const char* text) {
+    if (!text) {
+        return NULL;
+    }
+
+    size_t length = strlen(text);
+    event_string_t* str = event_string_alloc(pool, length);
+    if (str) {
+        memcpy(str->data, text, length);
+    }
+
+    return str;
+}
+
+event_string_t* event_string_format(event_string_pool_t* pool, const char* format, ...) {
+    if (!format) {
+        return NULL;
+    }
+
+    va_list args;
+    va_start(args, format);
+    int length = _vscprintf(format, args);
+    va_end(args);
+
+    if (length < 0) {
+        return NULL;
+    }
+
+    event_string_t* str = event_string_alloc(pool, (size_t)length);
+    if (str) {
+        va_start(args, format);
+        vsprintf_s(str->data, (size_t)length + 1, format, args);
+        va_end(args);
+    }
 
-        LeaveCriticalSection(&queue->lock);
+    return str;
+}
+
+event_string_t* event_string_retain(event_string_t* str) {
+    if (str) {
+        InterlockedIncrement(&str->ref_count);
+    }
+    return str;
+}
+
+void event_string_release(event_string_t* str) {
+    if (!str || InterlockedDecrement(&str->ref_count) != 0) {
+        return;
+    }
 
-        if (timeout_ms == 0) {
-            break;  //  ȯ
+    event_string_pool_t* pool = str->pool;
+    InterlockedDecrement(&pool->live_count);
+
+    //  ѵ Ѱų Ǯ  Ҵ̸ ٷ 
+    if (str->size_class < 0 ||
+        InterlockedIncrement(&pool->cached[str->size_class]) > EVENT_STRING_MAX_CACHED) {
+        if (str->size_class >= 0) {
+            InterlockedDecrement(&pool->cached[str->size_class]);
         }
+        _aligned_free(str);
+        return;
+    }
+
+    InterlockedPushEntrySList(&pool->free_lists[str->size_class], &str->free_entry);
+}
+
+const char* event_string_data(const event_string_t* str) {
+    return str ? str->data : "";
+}
 
-        Sleep(10);  // ª 
+void network_event_release(network_event_t* event) {
+    if (!event) {
+        return;
     }
 
-    return (timeout_ms == 0) ? -1 : -2;  // ť  Ǵ ŸӾƿ
+    event_string_release(event->message);
+    event_string_release(event->username);
+    event->message = NULL;
+    event->username = NULL;
 }
 
 // =============================================================================
@@ -794,21 +1165,15 @@ event_queue_t* event_queue_create(int capacity) {
         return NULL;
     }
 
-    queue->events = (network_event_t*)calloc(capacity, sizeof(network_event_t));
-    if (!queue->events) {
-        LOG_ERROR("Failed to allocate memory for event queue array");
+    if (ring_queue_init(&queue->ring, sizeof(network_event_t), capacity) != 0) {
+        LOG_ERROR("Failed to allocate event queue ring");
         free(queue);
         return NULL;
     }
 
-    queue->capacity = capacity;
-    queue->size = 0;
-    queue->front = 0;
-    queue->rear = 0;
-
-    InitializeCriticalSection(&queue->lock);
+    event_string_pool_init(&queue->strings);
 
-    LOG_DEBUG("Created event queue with capacity %d", capacity);
+    LOG_DEBUG("Created event queue with capacity %d", queue->ring.capacity);
     return queue;
 }
 
@@ -817,40 +1182,38 @@ void event_queue_destroy(event_queue_t* queue) {
         return;
     }
 
-    DeleteCriticalSection(&queue->lock);
-
-    if (queue->events) {
-        free(queue->events);
+    // ִ ̺Ʈ ڿ ȯ
+    network_event_t event;
+    while (ring_queue_try_pop(&queue->ring, &event) == 0) {
+        network_event_release(&event);
     }
 
+    ring_queue_destroy(&queue->ring);
+    event_string_pool_destroy(&queue->strings);
+
     free(queue);
     LOG_DEBUG("Event queue destroyed");
 }
 
 int event_queue_push(event_queue_t* queue, const network_event_t* event) {
     if (!queue || !event) {
+        if (event) {
+            event_string_release(event->message);
+            event_string_release(event->username);
+        }
         return -1;
     }
 
-    EnterCriticalSection(&queue->lock);
-
-    // ť   Ȯ
-    if (queue->size >= queue->capacity) {
-        // ť     ̺Ʈ  ( )
-        LOG_DEBUG("Event queue full, overwriting oldest event");
-        queue->front = (queue->front + 1) % queue->capacity;
-    }
-    else {
-        queue->size++;
+    // Һڸ    Ƿ     ̺Ʈ 
+    if (ring_queue_push(&queue->ring, event) != 0) {
+        InterlockedIncrement(&queue->ring.dropped);
+        LOG_DEBUG("Event queue full, dropping event (type: %d)", event->type);
+        event_string_release(event->message);
+        event_string_release(event->username);
+        return -1;
     }
 
-    // ̺Ʈ ߰
-    queue->events[queue->rear] = *event;
-    queue->rear = (queue->rear + 1) % queue->capacity;
-
-    LeaveCriticalSection(&queue->lock);
-
-    LOG_DEBUG("Event pushed to queue (type: %d, size: %d)", event->type, queue->size);
+    LOG_DEBUG("Event pushed to queue (type: %d, size: %d)", event->type, ring_queue_count(&queue->ring));
     return 0;
 }
 
@@ -859,40 +1222,39 @@ int event_queue_pop(event_queue_t* queue, network_event_t* event, int timeout_ms
         return -1;
     }
 
-    time_t start_time = time(NULL);
-    time_t end_time = start_time + (timeout_ms / 1000);
+    int result = ring_queue_pop(&queue->ring, event, timeout_ms);
+    if (result == 0) {
+        LOG_DEBUG("Event popped from queue (type: %d, size: %d)", event->type, ring_queue_count(&queue->ring));
+    }
 
-    while (time(NULL) <= end_time || timeout_ms == 0) {
-        EnterCriticalSection(&queue->lock);
+    return result;  // ť (-1) Ǵ ŸӾƿ(-2)
+}
 
-        if (queue->size > 0) {
-            // ̺Ʈ 
-            *event = queue->events[queue->front];
-            queue->front = (queue->front + 1) % queue->capacity;
-            queue->size--;
+// =============================================================================
+//  Լ
+// =============================================================================
 
-            LeaveCriticalSection(&queue->lock);
+static int client_post_command(chat_client_t* client, const ui_command_t* command) {
+    int result = command_queue_push(client->command_queue, command);
 
-            LOG_DEBUG("Event popped from queue (type: %d, size: %d)", event->type, queue->size);
-            return 0;
-        }
+    //    尡 ť ٸ Ƿ  ˸
+    if (result == 0 && client->reactor) {
+        client_reactor_notify(client->reactor, client);
+    }
 
-        LeaveCriticalSection(&queue->lock);
+    return result;
+}
 
-        if (timeout_ms == 0) {
-            break;  //  ȯ
-        }
+static int client_emit_event(chat_client_t* client, const network_event_t* event) {
+    int result = event_queue_push(client->event_queue, event);
 
-        Sleep(10);  // ª 
+    if (result == 0 && client->reactor) {
+        client_reactor_notify(client->reactor, client);
     }
 
-    return (timeout_ms == 0) ? -1 : -2;  // ť  Ǵ ŸӾƿ
+    return result;
 }
 
-// =============================================================================
-//  Լ
-// =============================================================================
-
 static int client_is_shutdown_requested(const chat_client_t* client) {
     return client->should_shutdown ||
         WaitForSingleObject(client->shutdown_event, 0) == WAIT_OBJECT_0;
@@ -940,7 +1302,7 @@ int client_connect_to_server(chat_client_t* client, const char* host, uint16_t p
     client_change_state(client, CLIENT_STATE_CONNECTING, CLIENT_EVENT_CONNECT_REQUESTED);
 
     //   ð 
-    client->connection_start_time = time(NULL);
+    client->connection_start_time = utils_clock_now_ms();
 
     //   Ʈ
     utils_string_copy(client->config.server_host, sizeof(client->config.server_host), host);
@@ -951,7 +1313,7 @@ int client_connect_to_server(chat_client_t* client, const char* host, uint16_t p
     connect_cmd.type = UI_CMD_CONNECT;
     sprintf_s(connect_cmd.data, sizeof(connect_cmd.data), "%s:%d", host, port);
 
-    if (command_queue_push(client->command_queue, &connect_cmd) != 0) {
+    if (client_post_command(client, &connect_cmd) != 0) {
         LOG_ERROR("Failed to queue connect command");
         client_change_state(client, CLIENT_STATE_DISCONNECTED, CLIENT_EVENT_CONNECTION_FAILED);
         return -1;
@@ -994,7 +1356,7 @@ int client_authenticate(chat_client_t* client, const char* username) {
     auth_cmd.type = UI_CMD_AUTHENTICATE;
     utils_string_copy(auth_cmd.data, sizeof(auth_cmd.data), username);
 
-    if (command_queue_push(client->command_queue, &auth_cmd) != 0) {
+    if (client_post_command(client, &auth_cmd) != 0) {
         LOG_ERROR("Failed to queue authentication command");
         client_change_state(client, CLIENT_STATE_CONNECTED, CLIENT_EVENT_AUTH_FAILED);
         return -1;
@@ -1025,7 +1387,7 @@ int client_disconnect(chat_client_t* client) {
     ui_command_t disconnect_cmd = { 0 };
     disconnect_cmd.type = UI_CMD_DISCONNECT;
 
-    if (command_queue_push(client->command_queue, &disconnect_cmd) != 0) {
+    if (client_post_command(client, &disconnect_cmd) != 0) {
         LOG_WARNING("Failed to queue disconnect command, forcing local disconnect");
 
         //  ť     
@@ -1051,8 +1413,10 @@ int client_send_chat_message(chat_client_t* client, const char* message) {
         return -1;
     }
 
-    //   Ȯ
-    if (!client_is_authenticated(client)) {
+    //   Ȯ (翬 ̸ Ʈũ 尡 ߴٰ   )
+    client_state_t state = client_get_current_state(client);
+    if (state != CLIENT_STATE_AUTHENTICATED && state != CLIENT_STATE_RECONNECTING &&
+        !(client->auth_after_connect && (state == CLIENT_STATE_CONNECTING || client_is_connected(client)))) {
         LOG_ERROR("Client is not authenticated");
         client_set_last_error(client, "Not authenticated");
         return -1;
@@ -1083,7 +1447,7 @@ int client_send_chat_message(chat_client_t* client, const char* message) {
     chat_cmd.type = UI_CMD_SEND_CHAT;
     utils_string_copy(chat_cmd.data, sizeof(chat_cmd.data), trimmed_message);
 
-    if (command_queue_push(client->command_queue, &chat_cmd) != 0) {
+    if (client_post_command(client, &chat_cmd) != 0) {
         LOG_ERROR("Failed to queue chat message");
         client_set_last_error(client, "Message queue full");
         return -1;
@@ -1097,8 +1461,10 @@ int client_request_user_list(chat_client_t* client) {
         return -1;
     }
 
-    //   Ȯ
-    if (!client_is_authenticated(client)) {
+    //   Ȯ (翬 ̸ Ʈũ 尡 ߴٰ   )
+    client_state_t state = client_get_current_state(client);
+    if (state != CLIENT_STATE_AUTHENTICATED && state != CLIENT_STATE_RECONNECTING &&
+        !(client->auth_after_connect && (state == CLIENT_STATE_CONNECTING || client_is_connected(client)))) {
         LOG_ERROR("Client is not authenticated");
         client_set_last_error(client, "Not authenticated");
         return -1;
@@ -1110,7 +1476,7 @@ int client_request_user_list(chat_client_t* client) {
     ui_command_t userlist_cmd = { 0 };
     userlist_cmd.type = UI_CMD_REQUEST_USER_LIST;
 
-    if (command_queue_push(client->command_queue, &userlist_cmd) != 0) {
+    if (client_post_command(client, &userlist_cmd) != 0) {
         LOG_ERROR("Failed to queue user list request");
         client_set_last_error(client, "Command queue full");
         return -1;
@@ -1133,7 +1499,7 @@ int client_send_heartbeat_ack(chat_client_t* client) {
     LOG_DEBUG("Sending heartbeat ACK");
 
     // ƮƮ ð Ʈ
-    client->last_heartbeat = time(NULL);
+    client->last_heartbeat = utils_clock_now_ms();
 
     //  ƮƮ ACK  network_thread  ó
     // ⼭ ð Ʈ
@@ -1172,12 +1538,8 @@ static int client_handle_connection_result(chat_client_t* client, int success, c
             client->config.server_host, client->config.server_port,
             error_message ? error_message : "Unknown error");
 
-        // ڵ 翬 õ
-        if (client->config.auto_reconnect) {
-            LOG_INFO("Auto-reconnect enabled, will retry in %d seconds",
-                client->config.reconnect_interval);
-
-            // 翬 Ÿ̸  (  network_thread)
+        // ڵ 翬 ̸ Ʈũ 尡   ٽ õ
+        if (client->config.auto_reconnect && client->auth_after_connect) {
             client->stats.reconnect_count++;
         }
 
@@ -1195,7 +1557,7 @@ static int client_handle_authentication_result(chat_client_t* client, int succes
         LOG_INFO("Successfully authenticated as '%s'", client->config.username);
 
         // ƮƮ 
-        client->last_heartbeat = time(NULL);
+        client->last_heartbeat = utils_clock_now_ms();
 
         return 0;
     }
@@ -1233,13 +1595,13 @@ static void client_handle_chat_received(chat_client_t* client, const char* usern
     event.timestamp = timestamp;
 
     if (username) {
-        utils_string_copy(event.username, sizeof(event.username), username);
+        event.username = event_string_create(&client->event_queue->strings, username);
     }
 
-    utils_string_copy(event.message, sizeof(event.message), message);
+    event.message = event_string_create(&client->event_queue->strings, message);
 
     // ̺Ʈ ť ߰
-    if (event_queue_push(client->event_queue, &event) != 0) {
+    if (client_emit_event(client, &event) != 0) {
         LOG_WARNING("Event queue full, chat message may be lost");
     }
 }
@@ -1255,10 +1617,10 @@ static void client_handle_user_list_received(chat_client_t* client, const char*
     network_event_t event = { 0 };
     event.type = NET_EVENT_USER_LIST_RECEIVED;
     event.timestamp = time(NULL);
-    utils_string_copy(event.message, sizeof(event.message), user_list);
+    event.message = event_string_create(&client->event_queue->strings, user_list);
 
     // ̺Ʈ ť ߰
-    if (event_queue_push(client->event_queue, &event) != 0) {
+    if (client_emit_event(client, &event) != 0) {
         LOG_WARNING("Event queue full, user list may be lost");
     }
 }
@@ -1274,11 +1636,11 @@ static void client_handle_user_joined(chat_client_t* client, const char* usernam
     network_event_t event = { 0 };
     event.type = NET_EVENT_USER_JOINED;
     event.timestamp = time(NULL);
-    utils_string_copy(event.username, sizeof(event.username), username);
-    sprintf_s(event.message, sizeof(event.message), "%s has joined the chat", username);
+    event.username = event_string_create(&client->event_queue->strings, username);
+    event.message = event_string_format(&client->event_queue->strings, "%s has joined the chat", username);
 
     // ̺Ʈ ť ߰
-    if (event_queue_push(client->event_queue, &event) != 0) {
+    if (client_emit_event(client, &event) != 0) {
         LOG_WARNING("Event queue full, user join notification may be lost");
     }
 }
@@ -1294,11 +1656,11 @@ static void client_handle_user_left(chat_client_t* client, const char* username)
     network_event_t event = { 0 };
     event.type = NET_EVENT_USER_LEFT;
     event.timestamp = time(NULL);
-    utils_string_copy(event.username, sizeof(event.username), username);
-    sprintf_s(event.message, sizeof(event.message), "%s has left the chat", username);
+    event.username = event_string_create(&client->event_queue->strings, username);
+    event.message = event_string_format(&client->event_queue->strings, "%s has left the chat", username);
 
     // ̺Ʈ ť ߰
-    if (event_queue_push(client->event_queue, &event) != 0) {
+    if (client_emit_event(client, &event) != 0) {
         LOG_WARNING("Event queue full, user leave notification may be lost");
     }
 }
@@ -1330,15 +1692,16 @@ static void client_handle_connection_lost(chat_client_t* client, const char* rea
     event.type = NET_EVENT_CONNECTION_STATUS;
     event.new_state = CLIENT_STATE_DISCONNECTED;
     event.timestamp = time(NULL);
-    sprintf_s(event.message, sizeof(event.message),
+    event.message = event_string_format(&client->event_queue->strings,
         "Connection lost: %s", reason ? reason : "Unknown reason");
 
     // ̺Ʈ ť ߰
-    event_queue_push(client->event_queue, &event);
+    client_emit_event(client, &event);
 
     // ڵ 翬 õ
     if (client->config.auto_reconnect && !client->should_shutdown) {
-        LOG_INFO("Scheduling reconnection in %d seconds", client->config.reconnect_interval);
+        int delay_sec = (int)((client->reconnect_delay_ms + 999) / 1000);
+        LOG_INFO("Scheduling reconnection in %d seconds", delay_sec);
 
         client->stats.reconnect_count++;
 
@@ -1347,13 +1710,31 @@ static void client_handle_connection_lost(chat_client_t* client, const char* rea
         reconnect_event.type = NET_EVENT_CONNECTION_STATUS;
         reconnect_event.new_state = CLIENT_STATE_RECONNECTING;
         reconnect_event.timestamp = time(NULL);
-        sprintf_s(reconnect_event.message, sizeof(reconnect_event.message),
-            "Reconnecting in %d seconds...", client->config.reconnect_interval);
+        reconnect_event.message = event_string_format(&client->event_queue->strings,
+            "Reconnecting in %d seconds...", delay_sec);
 
-        event_queue_push(client->event_queue, &reconnect_event);
+        client_emit_event(client, &reconnect_event);
     }
 }
 
+void client_set_event_handler(chat_client_t* client, client_event_handler_t handler, void* user_data) {
+    if (!client) return;
+
+    client->event_handler = handler;
+    client->event_handler_data = user_data;
+
+    LOG_DEBUG("Event handler %s", handler ? "registered" : "unregistered");
+}
+
+void client_set_frame_handler(chat_client_t* client, client_frame_handler_t handler, void* user_data) {
+    if (!client) return;
+
+    client->frame_handler = handler;
+    client->frame_handler_data = user_data;
+
+    LOG_DEBUG("Frame handler %s", handler ? "registered" : "unregistered");
+}
+
 void client_set_input_handler(chat_client_t* client, client_input_handler_t handler, void* user_data) {
     
     if (!client) return;
@@ -13,6 +13,7 @@
 //  
 // =============================================================================
 typedef struct chat_client_s chat_client_t;
+typedef struct client_reactor_s client_reactor_t;
 
 // =============================================================================
 // Ŭ̾Ʈ  
@@ -21,12 +22,22 @@ typedef struct chat_client_s chat_client_t;
 #define CLIENT_VERSION              "1.0.0"
 #define DEFAULT_SERVER_HOST         "localhost"
 #define DEFAULT_SERVER_PORT         8080        // ⺻  Ʈ
-#define CLIENT_RECONNECT_INTERVAL   5           // 翬  ()
+#define CLIENT_RECONNECT_INTERVAL   5           // 翬 ⺻  (,   ͸  þ)
+#define CLIENT_RECONNECT_MAX_DELAY  60          // 翬 ִ  ()
 #define CLIENT_HEARTBEAT_TIMEOUT    120          // ƮƮ ŸӾƿ ()
 #define CLIENT_CONNECT_TIMEOUT      10          //  ŸӾƿ ()
 #define MAX_MESSAGE_QUEUE_SIZE      100         // ޽ ť ִ ũ
+#define CLIENT_UI_POLL_MS           100         // client_run ִ  ð (Է Ȯ ֱ)
+#define CLIENT_POLL_EVENT_BATCH     256         // client_poll    ִ ̺Ʈ 
 #define MAX_COMMAND_LENGTH          256         // ɾ ִ 
 #define MAX_CHAT_MESSAGE_LENGTH     1024        // ä ޽ ִ 
+#define CLIENT_SPOOL_CAPACITY       64          // 翬   ִ ä 
+#define DEFAULT_HISTORY_LINES       10000       // ⺻ ũѹ  
+#define MIN_HISTORY_LINES           100         // ּ ũѹ  
+#define MAX_HISTORY_LINES           1000000     // ִ ũѹ  
+#define EVENT_STRING_CLASS_COUNT    4           // ̺Ʈ ڿ ũ   (64, 256, 1K, 4K)
+#define EVENT_STRING_MIN_CLASS_SIZE 64          //   ũ  (Ʈ)
+#define EVENT_STRING_MAX_CACHED     256         // ޺    ִ  
 
 // =============================================================================
 // Ŭ̾Ʈ  ӽ
@@ -69,18 +80,21 @@ typedef struct {
 
     //  
     int auto_reconnect;                 // ڵ 翬 
-    int reconnect_interval;             // 翬  ()
+    int reconnect_interval;             // 翬 ⺻  ()
     int connect_timeout;                //  ŸӾƿ ()
     int heartbeat_timeout;              // ƮƮ ŸӾƿ ()
 
     // UI 
     int show_timestamps;                // Ÿӽ ǥ
     int show_system_messages;           // ý ޽ ǥ
+    int history_lines;                  // ä 丮(ũѹ)  
     log_level_t log_level;              // α 
 
     //  
     int message_queue_size;             // ޽ ť ũ
     int network_buffer_size;            // Ʈũ  ũ
+    int enable_compression;             //    û
+    int enable_compact_header;          //    û (α  Ӵ 8~9Ʈ )
 } client_config_t;
 
 // =============================================================================
@@ -113,11 +127,31 @@ typedef enum {
     NET_EVENT_CONNECTION_STATUS         //   Ʈ
 } network_event_type_t;
 
+typedef struct event_string_pool_s event_string_pool_t;
+
+//  īƮ ڿ (Ǯ   ٷ ڿ ڿ Ͱ ̾)
+typedef struct {
+    SLIST_ENTRY free_entry;             // Ǯ ȯ  (ݵ ù )
+    event_string_pool_t* pool;          // Ҽ Ǯ
+    volatile LONG ref_count;            //  īƮ
+    int size_class;                     // ũ  (-1̸ Ǯ ۿ  Ҵ)
+    uint32_t length;                    // ڿ  (NUL )
+    char data[1];                       // ڿ  ( )
+} event_string_t;
+
+// ũ ޺   Ʈ
+struct event_string_pool_s {
+    SLIST_HEADER free_lists[EVENT_STRING_CLASS_COUNT];  // ޺  
+    volatile LONG cached[EVENT_STRING_CLASS_COUNT];     // ޺    
+    volatile LONG live_count;                           //   ڿ 
+};
+
+// ť   ũ ڵ鸸 ϰ ڿ Ǯ 
 typedef struct {
     network_event_type_t type;          // ̺Ʈ Ÿ
     client_state_t new_state;           //   (  )
-    char message[MAX_CHAT_MESSAGE_LENGTH]; // ޽ 
-    char username[MAX_USERNAME_LENGTH];    // ڸ ( ִ )
+    event_string_t* message;            // ޽  ( NULL)
+    event_string_t* username;           // ڸ ( ִ ,  NULL)
     time_t timestamp;                   // Ÿӽ
 } network_event_t;
 
@@ -125,22 +159,29 @@ typedef struct {
 // ޽ ť ü
 // =============================================================================
 
+//  Һ   
+// ڴ Ժ  ȣ CAS   ڸ Ȯϰ,
+// Һڴ    ť    ̺Ʈ ü 
+typedef struct {
+    char* slots;                       //   
+    volatile LONG* sequences;          // Ժ  ȣ
+    LONG element_size;                 //  ũ
+    LONG capacity;                     // 뷮 (2 ŵ)
+    LONG mask;                         // capacity - 1
+    volatile LONG enqueue_pos;         //  ġ
+    volatile LONG dequeue_pos;         // Һ ġ (Һ 常 )
+    volatile LONG consumer_waiting;    // Һڰ  ̸ 1
+    volatile LONG dropped;             //     
+    HANDLE not_empty_event;            //  ߰ ȣ (ڵ )
+} ring_queue_t;
+
 typedef struct {
-    ui_command_t* commands;             //  迭
-    int capacity;                       // 뷮
-    int size;                          //  ũ
-    int front;                         // ť 
-    int rear;                          // ť 
-    CRITICAL_SECTION lock;             // ȭ
+    ring_queue_t ring;                 // ui_command_t 
 } command_queue_t;
 
 typedef struct {
-    network_event_t* events;           // ̺Ʈ 迭
-    int capacity;                      // 뷮
-    int size;                         //  ũ
-    int front;                        // ť 
-    int rear;                         // ť 
-    CRITICAL_SECTION lock;            // ȭ
+    ring_queue_t ring;                 // network_event_t 
+    event_string_pool_t strings;       // ̺Ʈ ڿ Ǯ
 } event_queue_t;
 
 // =============================================================================
@@ -156,14 +197,40 @@ typedef struct {
     uint64_t bytes_received;           //  Ʈ 
     uint32_t reconnect_count;          // 翬 Ƚ
     uint32_t connection_failures;      //   Ƚ
+    network_rtt_t rtt;                 //  պ ð (ƮƮ ACK պ )
 } client_statistics_t;
 
+// =============================================================================
+// ۽  ä (翬  )
+// =============================================================================
+
+//   ߰ų  Ȯ(ڱ ޽ )   ä
+typedef struct {
+    uint32_t message_id;               //  ȿ ϴ ޽ ID ( ߺ )
+    char* text;                        // ä  ( Ҵ)
+    int sent;                          //    1
+} client_spool_entry_t;
+
+// Ʈũ (Ǵ ) ϴ   ( )
+typedef struct {
+    client_spool_entry_t entries[CLIENT_SPOOL_CAPACITY];
+    int head;                          //   ׸ ġ
+    int count;                         //   ׸ 
+    uint32_t next_message_id;          //   ޽ ID (1)
+} client_outbound_spool_t;
+
 // =============================================================================
 //  Ŭ̾Ʈ ü
 // =============================================================================
 
 typedef int (*client_input_handler_t)(chat_client_t* client, void* user_data);
 
+// Ʈũ ̺Ʈ ݹ (client_poll ȣ  Ǵ  忡 , event ݹ ȸ ȿ)
+typedef void (*client_event_handler_t)(chat_client_t* client, const network_event_t* event, void* user_data);
+
+//  ݹ (client_run  ȣ,  ȣ ʿ ms Ǵ -1 ȯ)
+typedef int (*client_frame_handler_t)(chat_client_t* client, void* user_data);
+
 typedef struct chat_client_s {
     // Ŭ̾Ʈ 
     client_state_t current_state;      //  
@@ -187,8 +254,8 @@ typedef struct chat_client_s {
     HANDLE shutdown_event;             //  ̺Ʈ
 
     //  
-    time_t last_heartbeat;             //  ƮƮ
-    time_t connection_start_time;      //   ð
+    uint64_t last_heartbeat;           //    ð (utils_clock_now_ms )
+    uint64_t connection_start_time;    //   ð (utils_clock_now_ms , 0̸   )
     char last_error[256];              //   ޽
 
     // 
@@ -196,6 +263,34 @@ typedef struct chat_client_s {
 
     client_input_handler_t input_handler;
     void* input_handler_data;
+
+    // ̺Ʈ  (ܼ UI,   Ʈ尡 )
+    client_event_handler_t event_handler;
+    void* event_handler_data;
+    client_frame_handler_t frame_handler;
+    void* frame_handler_data;
+    uint64_t last_status_check;        //  ƮƮ ŸӾƿ ˻ ð
+
+    // Ʈũ   (Ǻ)
+    WSAEVENT socket_event;             //   б/ ˸ ̺Ʈ
+    SOCKET bound_socket;               // socket_event  
+    ULONGLONG next_reconnect_ms;       //  翬 õ ð (utils_clock_now_ms )
+    DWORD reconnect_delay_ms;          //   翬  ( ϸ 0)
+    DWORD retry_after_ms;              //  ȭ  ˷ ּ õ 
+    network_connector_t connector;     //   񵿱  (ּҺ  õ)
+    int auth_after_connect;            //  ϷǸ ٷ  û (翬 )
+    int auth_pending;                  // /簳 û    (   ٲ  Ƿ ٸ   )
+    char resume_token[SESSION_TOKEN_LENGTH + 1]; //  ߱  簳 ū (  ڿ)
+    uint32_t last_sequence;            //   ä  (簳  ģ ޽ û)
+    client_outbound_spool_t spool;     // 翬  ߴٰ      ä
+
+    //    (client_reactor_attach  Ǹ )
+    client_reactor_t* reactor;         // Ҽ  (NULL̸  Ʈũ  Ǵ )
+    SLIST_ENTRY reactor_entry;         //  ó   
+    volatile LONG reactor_queued;      // ó  Ͽ  1
+    volatile LONG reactor_request;     // ̱/ û (client_reactor_request_t)
+    int reactor_slot;                  //   迭 ġ (-1̸ )
+    ULONGLONG reactor_timer_due;       //  Ÿ̸  ð (0̸ )
 } chat_client_t;
 
 // =============================================================================
@@ -230,12 +325,22 @@ int client_start(chat_client_t* client);
 int client_shutdown(chat_client_t* client);
 
 /**
- * Ŭ̾Ʈ   (UI 忡 )
+ * Ŭ̾Ʈ   (ȣ 忡   )
+ * ̺Ʈ ϵ ̺Ʈ ݹ, Է° ȭ  Է/ ݹ ó
  * @param client Ŭ̾Ʈ νϽ
  * @return    0,   
  */
 int client_run(chat_client_t* client);
 
+/**
+ *   Ʈũ ̺Ʈ ̺Ʈ ݹ  (帮 )
+ * ƮƮ ŸӾƿ ˻絵 Բ 
+ * @param client Ŭ̾Ʈ νϽ
+ * @param timeout_ms ̺Ʈ    ð (0̸  ȯ)
+ * @return  ̺Ʈ ,   -1
+ */
+int client_poll(chat_client_t* client, int timeout_ms);
+
 // =============================================================================
 //   Լ
 // =============================================================================
@@ -356,7 +461,7 @@ command_queue_t* command_queue_create(int capacity);
 void command_queue_destroy(command_queue_t* queue);
 
 /**
- *  ť ߰ ( )
+ *  ť ߰ ( ,  )
  * @param queue ť
  * @param command ߰ 
  * @return   0,    (ť )
@@ -364,7 +469,7 @@ void command_queue_destroy(command_queue_t* queue);
 int command_queue_push(command_queue_t* queue, const ui_command_t* command);
 
 /**
- *  ť  ( )
+ *  ť  (Һ  ,   timeout_ms )
  * @param queue ť
  * @param command   ()
  * @param timeout_ms ŸӾƿ (и, 0̸  ȯ)
@@ -372,6 +477,21 @@ int command_queue_push(command_queue_t* queue, const ui_command_t* command);
  */
 int command_queue_pop(command_queue_t* queue, ui_command_t* command, int timeout_ms);
 
+/**
+ *  ť   (Һ  )
+ * ȯ ڵ ٸ ڵ Բ WaitForMultipleObjects ٸ  
+ * Ⱑ  ݵ command_queue_end_wait ȣؾ 
+ * @param queue ť
+ * @return  ̺Ʈ ڵ, ̹   NULL (  )
+ */
+HANDLE command_queue_begin_wait(command_queue_t* queue);
+
+/**
+ *  ť   (command_queue_begin_wait ¦)
+ * @param queue ť
+ */
+void command_queue_end_wait(command_queue_t* queue);
+
 /**
  * ̺Ʈ ť 
  * @param capacity ť 뷮
@@ -386,7 +506,9 @@ event_queue_t* event_queue_create(int capacity);
 void event_queue_destroy(event_queue_t* queue);
 
 /**
- * ̺Ʈ ť ߰ ( )
+ * ̺Ʈ ť ߰ ( ,  )
+ * ̺Ʈ ڿ  ť Ѿ,  ÿ ť 
+ * ť    ̺Ʈ  dropped ī͸ Ŵ
  * @param queue ť
  * @param event ߰ ̺Ʈ
  * @return   0,    (ť )
@@ -394,7 +516,8 @@ void event_queue_destroy(event_queue_t* queue);
 int event_queue_push(event_queue_t* queue, const network_event_t* event);
 
 /**
- * ̺Ʈ ť  ( )
+ * ̺Ʈ ť  (Һ  ,   timeout_ms )
+ *  ̺Ʈ ó  network_event_release ؾ 
  * @param queue ť
  * @param event  ̺Ʈ ()
  * @param timeout_ms ŸӾƿ (и, 0̸  ȯ)
@@ -402,6 +525,54 @@ int event_queue_push(event_queue_t* queue, const network_event_t* event);
  */
 int event_queue_pop(event_queue_t* queue, network_event_t* event, int timeout_ms);
 
+// =============================================================================
+// ̺Ʈ ڿ Լ
+// =============================================================================
+
+/**
+ * Ǯ ڿ Ҵϰ   ( īƮ 1)
+ *  ū ޺  ڿ Ǯ ۿ  Ҵ
+ * @param pool ڿ Ǯ
+ * @param text  ڿ
+ * @return ڿ ڵ,   NULL
+ */
+event_string_t* event_string_create(event_string_pool_t* pool, const char* text);
+
+/**
+ *  ڿ Ǯ ڿ  ( īƮ 1)
+ * @param pool ڿ Ǯ
+ * @param format printf  ڿ
+ * @return ڿ ڵ,   NULL
+ */
+event_string_t* event_string_format(event_string_pool_t* pool, const char* format, ...);
+
+/**
+ * ڿ  ߰
+ * @param str ڿ ڵ (NULL )
+ * @return  ڿ ڵ
+ */
+event_string_t* event_string_retain(event_string_t* str);
+
+/**
+ * ڿ   ( ̸ Ǯ ȯ)
+ * @param str ڿ ڵ (NULL )
+ */
+void event_string_release(event_string_t* str);
+
+/**
+ * ڿ  ȸ
+ * @param str ڿ ڵ (NULL )
+ * @return ڿ , ڵ NULL̸  ڿ
+ */
+const char* event_string_data(const event_string_t* str);
+
+/**
+ * ̺Ʈ  ڿ   
+ * event_queue_pop  ̺Ʈ ó  ݵ ȣؾ 
+ * @param event ̺Ʈ
+ */
+void network_event_release(network_event_t* event);
+
 // =============================================================================
 //   ƿƼ Լ
 // =============================================================================
@@ -459,37 +630,31 @@ const char* client_get_last_error(chat_client_t* client, char* buffer, size_t bu
 DWORD WINAPI client_network_thread_proc(LPVOID param);
 
 // =============================================================================
-// UI  Լ ( Ͽ )
+// Ʈ ݹ 
 // =============================================================================
 
 /**
- * ܼ UI ʱȭ
- * @param client Ŭ̾Ʈ νϽ
- * @return   0,   
- */
-int client_ui_initialize(chat_client_t* client);
-
-/**
- * ܼ UI 
+ * Ʈũ ̺Ʈ ݹ 
  * @param client Ŭ̾Ʈ νϽ
+ * @param handler ̺Ʈ ݹ (NULL̸ ̺Ʈ )
+ * @param user_data ݹ鿡   
  */
-void client_ui_cleanup(chat_client_t* client);
+void client_set_event_handler(chat_client_t* client, client_event_handler_t handler, void* user_data);
 
 /**
- *  Է ó
+ *  ݹ  (client_run  ȭ   )
  * @param client Ŭ̾Ʈ νϽ
- * @param input Է ڿ
- * @return  ϸ 0,  û  1
+ * @param handler  ݹ (NULL )
+ * @param user_data ݹ鿡   
  */
-int client_ui_handle_input(chat_client_t* client, const char* input);
+void client_set_frame_handler(chat_client_t* client, client_frame_handler_t handler, void* user_data);
 
 /**
- * Ʈũ ̺Ʈ ȭ 
+ * Է ݹ  (client_run  ȣ)
  * @param client Ŭ̾Ʈ νϽ
- * @param event  ̺Ʈ
+ * @param handler Է ݹ (NULL )
+ * @param user_data ݹ鿡   
  */
-void client_ui_display_event(chat_client_t* client, const network_event_t* event);
-
 void client_set_input_handler(chat_client_t* client, client_input_handler_t handler, void* user_data);
 
 // =============================================================================
@@ -0,0 +1,590 @@
+#define LOG_MODULE LOG_MODULE_CLIENT
+
+#include "client_reactor.h"
+#include "network_thread.h"
+#include <stdlib.h>
+#include <string.h>
+
+// =============================================================================
+//   Լ 
+// =============================================================================
+
+static DWORD WINAPI client_reactor_thread_proc(LPVOID param);
+static SOCKET client_reactor_create_wake_socket(void);
+static void client_reactor_wake(client_reactor_t* reactor);
+static void client_reactor_drain_wake_socket(client_reactor_t* reactor);
+static int client_reactor_process_ready_list(client_reactor_t* reactor);
+static int client_reactor_process_timers(client_reactor_t* reactor, ULONGLONG now);
+static int client_reactor_process_sockets(client_reactor_t* reactor);
+static int client_reactor_service(client_reactor_t* reactor, chat_client_t* client);
+static void client_reactor_add_session(client_reactor_t* reactor, chat_client_t* client);
+static void client_reactor_remove_session(client_reactor_t* reactor, chat_client_t* client);
+static void client_reactor_arm_timer(client_reactor_t* reactor, chat_client_t* client);
+static ULONGLONG client_reactor_next_deadline(const chat_client_t* client, ULONGLONG now);
+static int client_reactor_timer_push(client_reactor_t* reactor, ULONGLONG due_ms, chat_client_t* session);
+static void client_reactor_timer_pop(client_reactor_t* reactor);
+static void client_reactor_timer_remove_session(client_reactor_t* reactor, chat_client_t* session);
+
+// =============================================================================
+//    
+// =============================================================================
+
+client_reactor_t* client_reactor_create(int max_sessions) {
+    if (max_sessions <= 0) {
+        max_sessions = CLIENT_REACTOR_DEFAULT_SESSIONS;
+    }
+
+    if (!network_is_initialized()) {
+        if (network_initialize() != NETWORK_SUCCESS) {
+            LOG_ERROR("Failed to initialize network for reactor");
+            return NULL;
+        }
+    }
+
+    client_reactor_t* reactor = (client_reactor_t*)calloc(1, sizeof(client_reactor_t));
+    if (!reactor) {
+        LOG_ERROR("Failed to allocate client reactor");
+        return NULL;
+    }
+
+    reactor->max_sessions = max_sessions;
+    reactor->sessions = (chat_client_t**)calloc(max_sessions, sizeof(chat_client_t*));
+    reactor->poll_fds = (WSAPOLLFD*)calloc(max_sessions + 1, sizeof(WSAPOLLFD));
+    reactor->ready_event = CreateEvent(NULL, FALSE, FALSE, NULL);
+    reactor->wake_socket = client_reactor_create_wake_socket();
+    InitializeSListHead(&reactor->ready_list);
+
+    if (!reactor->sessions || !reactor->poll_fds || !reactor->ready_event ||
+        reactor->wake_socket == INVALID_SOCKET) {
+        LOG_ERROR("Failed to initialize client reactor");
+        client_reactor_destroy(reactor);
+        return NULL;
+    }
+
+    reactor->poll_fds[0].fd = reactor->wake_socket;
+    reactor->poll_fds[0].events = POLLRDNORM;
+
+    reactor->thread = CreateThread(NULL, 0, client_reactor_thread_proc, reactor, 0, &reactor->thread_id);
+    if (!reactor->thread) {
+        LOG_ERROR("Failed to create reactor thread (error %lu)", GetLastError());
+        client_reactor_destroy(reactor);
+        return NULL;
+    }
+
+    if (WaitForSingleObject(reactor->ready_event, CLIENT_REACTOR_ATTACH_TIMEOUT_MS) != WAIT_OBJECT_0) {
+        LOG_ERROR("Reactor thread failed to start within timeout");
+        client_reactor_destroy(reactor);
+        return NULL;
+    }
+
+    LOG_INFO("Client reactor started (max sessions: %d)", max_sessions);
+    return reactor;
+}
+
+void client_reactor_destroy(client_reactor_t* reactor) {
+    if (!reactor) {
+        return;
+    }
+
+    if (reactor->thread) {
+        reactor->should_shutdown = 1;
+        client_reactor_wake(reactor);
+        WaitForSingleObject(reactor->thread, INFINITE);
+        CloseHandle(reactor->thread);
+        reactor->thread = NULL;
+    }
+
+    if (reactor->wake_socket != INVALID_SOCKET) {
+        closesocket(reactor->wake_socket);
+    }
+
+    if (reactor->ready_event) {
+        CloseHandle(reactor->ready_event);
+    }
+
+    free(reactor->timers);
+    free(reactor->poll_fds);
+    free(reactor->sessions);
+    free(reactor);
+
+    LOG_INFO("Client reactor destroyed");
+}
+
+// =============================================================================
+//  ̱/
+// =============================================================================
+
+int client_reactor_attach(client_reactor_t* reactor, chat_client_t* client) {
+    if (!reactor || !client) {
+        return -1;
+    }
+
+    if (client->reactor || client->network_thread) {
+        LOG_ERROR("Client is already running");
+        return -1;
+    }
+
+    client_state_t current_state = client_get_current_state(client);
+    if (current_state != CLIENT_STATE_DISCONNECTED) {
+        LOG_ERROR("Client is not in disconnected state (current: %s)",
+            client_state_to_string(current_state));
+        return -1;
+    }
+
+    if (client_session_open(client) != 0) {
+        return -1;
+    }
+
+    ResetEvent(client->shutdown_event);
+    client->should_shutdown = 0;
+    client->reactor_slot = -1;
+    client->reactor_timer_due = 0;
+    client->reactor = reactor;
+    client->reactor_request = CLIENT_REACTOR_REQUEST_ATTACH;
+    client_reactor_notify(reactor, client);
+
+    //  忡 ȣ  ݺ ߰
+    if (GetCurrentThreadId() == reactor->thread_id) {
+        return 0;
+    }
+
+    if (WaitForSingleObject(client->network_ready_event, CLIENT_REACTOR_ATTACH_TIMEOUT_MS) != WAIT_OBJECT_0 ||
+        client->reactor_slot < 0) {
+        LOG_ERROR("Reactor did not accept the session");
+        client_reactor_detach(reactor, client);
+        return -1;
+    }
+
+    return 0;
+}
+
+int client_reactor_detach(client_reactor_t* reactor, chat_client_t* client) {
+    if (!reactor || !client || client->reactor != reactor) {
+        return -1;
+    }
+
+    if (GetCurrentThreadId() == reactor->thread_id) {
+        LOG_ERROR("Cannot detach a session from a reactor callback (use client_disconnect)");
+        return -1;
+    }
+
+    client->reactor_request = CLIENT_REACTOR_REQUEST_DETACH;
+    client_reactor_notify(reactor, client);
+
+    if (WaitForSingleObject(client->network_ready_event, CLIENT_REACTOR_ATTACH_TIMEOUT_MS) != WAIT_OBJECT_0) {
+        LOG_ERROR("Reactor did not release the session within timeout");
+        return -1;
+    }
+
+    return 0;
+}
+
+void client_reactor_notify(client_reactor_t* reactor, chat_client_t* client) {
+    if (!reactor || !client) {
+        return;
+    }
+
+    // ̹ Ͽ  ٽ   (  ÷׸  Ƿ ˸ ǵ )
+    if (InterlockedCompareExchange(&client->reactor_queued, 1, 0) == 0) {
+        InterlockedPushEntrySList(&reactor->ready_list, &client->reactor_entry);
+    }
+
+    //      ٽ ȮϹǷ  ʿ 
+    if (GetCurrentThreadId() != reactor->thread_id) {
+        client_reactor_wake(reactor);
+    }
+}
+
+int client_reactor_session_count(const client_reactor_t* reactor) {
+    return reactor ? reactor->session_count : 0;
+}
+
+// =============================================================================
+//  
+// =============================================================================
+
+static DWORD WINAPI client_reactor_thread_proc(LPVOID param) {
+    client_reactor_t* reactor = (client_reactor_t*)param;
+
+    LOG_INFO("Reactor thread started");
+    SetEvent(reactor->ready_event);
+
+    int more_work = 0;
+
+    while (!reactor->should_shutdown) {
+        ULONGLONG now = utils_clock_update();
+
+        more_work = client_reactor_process_timers(reactor, now);
+        more_work |= client_reactor_process_ready_list(reactor);
+
+        // ó     ϸ Ȯ
+        int timeout_ms = -1;
+        if (more_work || QueryDepthSList(&reactor->ready_list) > 0) {
+            timeout_ms = 0;
+        }
+        else if (reactor->timer_count > 0) {
+            ULONGLONG due = reactor->timers[0].due_ms;
+            now = utils_clock_update();
+            timeout_ms = due <= now ? 0 : (int)(due - now);
+        }
+
+        int ready = WSAPoll(reactor->poll_fds, (ULONG)(reactor->session_count + 1), timeout_ms);
+        if (ready == SOCKET_ERROR) {
+            LOG_ERROR("WSAPoll failed (error %d)", WSAGetLastError());
+            Sleep(10);
+            continue;
+        }
+
+        if (ready > 0) {
+            if (reactor->poll_fds[0].revents) {
+                client_reactor_drain_wake_socket(reactor);
+            }
+            more_work = client_reactor_process_sockets(reactor);
+        }
+    }
+
+    //    ( û   嵵 )
+    while (reactor->session_count > 0) {
+        chat_client_t* client = reactor->sessions[reactor->session_count - 1];
+        client_reactor_remove_session(reactor, client);
+    }
+
+    LOG_INFO("Reactor thread exiting");
+    return 0;
+}
+
+static int client_reactor_process_ready_list(client_reactor_t* reactor) {
+    int more_work = 0;
+
+    PSLIST_ENTRY entry = InterlockedFlushSList(&reactor->ready_list);
+    while (entry) {
+        chat_client_t* client = CONTAINING_RECORD(entry, chat_client_t, reactor_entry);
+        entry = entry->Next;  // ó ߿   ٽ Ͽ   Ƿ  
+
+        InterlockedExchange(&client->reactor_queued, 0);
+
+        LONG request = InterlockedExchange(&client->reactor_request, CLIENT_REACTOR_REQUEST_NONE);
+        if (request == CLIENT_REACTOR_REQUEST_DETACH) {
+            client_reactor_remove_session(reactor, client);
+            continue;
+        }
+
+        if (request == CLIENT_REACTOR_REQUEST_ATTACH) {
+            client_reactor_add_session(reactor, client);
+            if (client->reactor_slot < 0) {
+                continue;
+            }
+        }
+
+        more_work |= client_reactor_service(reactor, client);
+    }
+
+    return more_work;
+}
+
+static int client_reactor_process_timers(client_reactor_t* reactor, ULONGLONG now) {
+    int processed = 0;
+
+    while (reactor->timer_count > 0 && reactor->timers[0].due_ms <= now) {
+        if (processed >= CLIENT_REACTOR_TIMER_BATCH) {
+            return 1;
+        }
+
+        client_reactor_timer_t timer = reactor->timers[0];
+        client_reactor_timer_pop(reactor);
+
+        //  ̸ ð ٽ Ǿ ҵ ׸
+        if (timer.session->reactor_timer_due != timer.due_ms) {
+            continue;
+        }
+
+        timer.session->reactor_timer_due = 0;
+        client_session_process_timers(timer.session);
+        client_reactor_service(reactor, timer.session);
+        processed++;
+    }
+
+    return 0;
+}
+
+static int client_reactor_process_sockets(client_reactor_t* reactor) {
+    int more_work = 0;
+
+    // ó   ŵǸ    ڸ ŰǷ ڿ ȸ
+    for (int i = reactor->session_count - 1; i >= 0; i--) {
+        if (i >= reactor->session_count) {
+            continue;
+        }
+
+        WSAPOLLFD* poll_fd = &reactor->poll_fds[i + 1];
+        if (!poll_fd->revents) {
+            continue;
+        }
+        poll_fd->revents = 0;
+
+        chat_client_t* client = reactor->sessions[i];
+        more_work |= client_session_process_input(client);
+        more_work |= client_reactor_service(reactor, client);
+    }
+
+    return more_work;
+}
+
+static int client_reactor_service(client_reactor_t* reactor, chat_client_t* client) {
+    int rounds = 0;
+    int work_done;
+
+    // ̺Ʈ ݹ  ɰ   ̺Ʈ   ó
+    do {
+        work_done = client_session_process_commands(client);
+        work_done += client_poll(client, 0);
+    } while (work_done > 0 && ++rounds < CLIENT_REACTOR_SERVICE_ROUNDS);
+
+    //     (/ ٲ  )
+    if (client->reactor_slot >= 0) {
+        WSAPOLLFD* poll_fd = &reactor->poll_fds[client->reactor_slot + 1];
+        short events = POLLRDNORM;
+        SOCKET handle = client_session_poll_handle(client, &events);
+        if (poll_fd->fd != handle || poll_fd->events != events) {
+            poll_fd->fd = handle;
+            poll_fd->events = events;
+            poll_fd->revents = 0;
+        }
+    }
+
+    client_reactor_arm_timer(reactor, client);
+
+    return work_done > 0;
+}
+
+// =============================================================================
+//  迭  (  )
+// =============================================================================
+
+static void client_reactor_add_session(client_reactor_t* reactor, chat_client_t* client) {
+    if (reactor->session_count >= reactor->max_sessions) {
+        LOG_ERROR("Reactor session limit reached (%d)", reactor->max_sessions);
+
+        //    detach   Ƿ attach  ڿ ⼭ 
+        client_session_close(client);
+        client->reactor_slot = -1;
+        client->reactor = NULL;
+        SetEvent(client->network_ready_event);
+        return;
+    }
+
+    int slot = reactor->session_count++;
+    reactor->sessions[slot] = client;
+    reactor->poll_fds[slot + 1].fd = INVALID_SOCKET;   //  ڵ WSAPoll 
+    reactor->poll_fds[slot + 1].events = POLLRDNORM;
+    reactor->poll_fds[slot + 1].revents = 0;
+    client->reactor_slot = slot;
+
+    LOG_DEBUG("Session attached to reactor (slot %d, total %d)", slot, reactor->session_count);
+    SetEvent(client->network_ready_event);
+}
+
+static void client_reactor_remove_session(client_reactor_t* reactor, chat_client_t* client) {
+    int slot = client->reactor_slot;
+
+    if (slot >= 0 && slot < reactor->session_count && reactor->sessions[slot] == client) {
+        //    ڸ ű
+        int last = --reactor->session_count;
+        if (slot != last) {
+            reactor->sessions[slot] = reactor->sessions[last];
+            reactor->poll_fds[slot + 1] = reactor->poll_fds[last + 1];
+            reactor->sessions[slot]->reactor_slot = slot;
+        }
+        reactor->sessions[last] = NULL;
+    }
+
+    client_reactor_timer_remove_session(reactor, client);
+    client_session_close(client);
+
+    client->reactor_slot = -1;
+    client->reactor_timer_due = 0;
+    client->reactor = NULL;
+
+    LOG_DEBUG("Session detached from reactor (total %d)", reactor->session_count);
+    SetEvent(client->network_ready_event);
+}
+
+// =============================================================================
+// Ÿ̸ (Ǻ  ƮƮ/翬 ð)
+// =============================================================================
+
+static ULONGLONG client_reactor_next_deadline(const chat_client_t* client, ULONGLONG now) {
+    //  ̸  ּ õ ð Ǵ  ŸӾƿ
+    // (WSAPoll  ֱ õ Ƿ  õ  ֱ ٽ Ȯε)
+    int connect_timeout = network_connector_next_timeout(&client->connector);
+    if (connect_timeout >= 0) {
+        if (client->connector.active_attempts > 1 && connect_timeout > NETWORK_CONNECT_ATTEMPT_DELAY_MS) {
+            connect_timeout = NETWORK_CONNECT_ATTEMPT_DELAY_MS;
+        }
+        return now + (ULONGLONG)connect_timeout + 1;
+    }
+
+    if (client->config.auto_reconnect &&
+        client_get_current_state((chat_client_t*)client) == CLIENT_STATE_RECONNECTING) {
+        //   翬 ð (Ǹ Ͱ ޶ Ѳ  )
+        return client->next_reconnect_ms > now ? client->next_reconnect_ms : now + 1;
+    }
+
+    if (!client_is_connected(client)) {
+        return 0;
+    }
+
+    //    heartbeat_timeout  ð
+    ULONGLONG due = client->last_heartbeat + (ULONGLONG)client->config.heartbeat_timeout * 1000 + 1;
+    return due > now ? due : now + 1;
+}
+
+static void client_reactor_arm_timer(client_reactor_t* reactor, chat_client_t* client) {
+    if (client->reactor_slot < 0) {
+        return;
+    }
+
+    ULONGLONG due = client_reactor_next_deadline(client, utils_clock_now_ms());
+    if (due == 0) {
+        return;  //  ׸    ƹ ϵ  ʰ 
+    }
+
+    //   ð  ׸   ٽ ϹǷ  ̸  ߰
+    if (client->reactor_timer_due == 0 || due < client->reactor_timer_due) {
+        if (client_reactor_timer_push(reactor, due, client) == 0) {
+            client->reactor_timer_due = due;
+        }
+    }
+}
+
+static int client_reactor_timer_push(client_reactor_t* reactor, ULONGLONG due_ms, chat_client_t* session) {
+    if (reactor->timer_count >= reactor->timer_capacity) {
+        int new_capacity = reactor->timer_capacity > 0 ? reactor->timer_capacity * 2 : 64;
+        client_reactor_timer_t* timers = (client_reactor_timer_t*)realloc(
+            reactor->timers, new_capacity * sizeof(client_reactor_timer_t));
+        if (!timers) {
+            LOG_ERROR("Failed to grow reactor timer heap");
+            return -1;
+        }
+        reactor->timers = timers;
+        reactor->timer_capacity = new_capacity;
+    }
+
+    //  ø
+    int index = reactor->timer_count++;
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (reactor->timers[parent].due_ms <= due_ms) {
+            break;
+        }
+        reactor->timers[index] = reactor->timers[parent];
+        index = parent;
+    }
+
+    reactor->timers[index].due_ms = due_ms;
+    reactor->timers[index].session = session;
+    return 0;
+}
+
+static void client_reactor_timer_pop(client_reactor_t* reactor) {
+    if (reactor->timer_count == 0) {
+        return;
+    }
+
+    client_reactor_timer_t last = reactor->timers[--reactor->timer_count];
+    int count = reactor->timer_count;
+    int index = 0;
+
+    // Ʒ 
+    for (;;) {
+        int child = index * 2 + 1;
+        if (child >= count) {
+            break;
+        }
+        if (child + 1 < count && reactor->timers[child + 1].due_ms < reactor->timers[child].due_ms) {
+            child++;
+        }
+        if (last.due_ms <= reactor->timers[child].due_ms) {
+            break;
+        }
+        reactor->timers[index] = reactor->timers[child];
+        index = child;
+    }
+
+    if (count > 0) {
+        reactor->timers[index] = last;
+    }
+}
+
+static void client_reactor_timer_remove_session(client_reactor_t* reactor, chat_client_t* session) {
+    //     ׸ ۸ Ͱ  ʵ ɷ   ٽ 
+    int kept = 0;
+    for (int i = 0; i < reactor->timer_count; i++) {
+        if (reactor->timers[i].session != session) {
+            reactor->timers[kept++] = reactor->timers[i];
+        }
+    }
+
+    if (kept == reactor->timer_count) {
+        return;
+    }
+
+    client_reactor_timer_t* entries = reactor->timers;
+    reactor->timer_count = 0;
+    for (int i = 0; i < kept; i++) {
+        client_reactor_timer_t entry = entries[i];
+        client_reactor_timer_push(reactor, entry.due_ms, entry.session);
+    }
+}
+
+// =============================================================================
+//  
+// =============================================================================
+
+static SOCKET client_reactor_create_wake_socket(void) {
+    SOCKET sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (sock == INVALID_SOCKET) {
+        LOG_ERROR("Failed to create reactor wake socket (error %d)", WSAGetLastError());
+        return INVALID_SOCKET;
+    }
+
+    //   Ʈ ε  ڱ ڽſ 
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+
+    int addr_len = sizeof(addr);
+    u_long nonblocking = 1;
+
+    if (bind(sock, (struct sockaddr*)&addr, sizeof(addr)) == SOCKET_ERROR ||
+        getsockname(sock, (struct sockaddr*)&addr, &addr_len) == SOCKET_ERROR ||
+        connect(sock, (struct sockaddr*)&addr, addr_len) == SOCKET_ERROR ||
+        ioctlsocket(sock, FIONBIO, &nonblocking) == SOCKET_ERROR) {
+        LOG_ERROR("Failed to set up reactor wake socket (error %d)", WSAGetLastError());
+        closesocket(sock);
+        return INVALID_SOCKET;
+    }
+
+    return sock;
+}
+
+static void client_reactor_wake(client_reactor_t* reactor) {
+    // Ͱ   Ʈ  ʾ   
+    if (InterlockedExchange(&reactor->wake_pending, 1) == 0) {
+        char signal_byte = 1;
+        send(reactor->wake_socket, &signal_byte, 1, 0);
+    }
+}
+
+static void client_reactor_drain_wake_socket(client_reactor_t* reactor) {
+    char buffer[64];
+
+    // Ʈ    ÷׸  (ݴ   ̿  ⸦   )
+    while (recv(reactor->wake_socket, buffer, sizeof(buffer), 0) > 0) {
+    }
+    InterlockedExchange(&reactor->wake_pending, 0);
+
+    reactor->poll_fds[0].revents = 0;
+}
@@ -0,0 +1,110 @@
+#ifndef CLIENT_REACTOR_H
+#define CLIENT_REACTOR_H
+
+#include "client.h"
+#include <windows.h>
+
+// =============================================================================
+//  
+// =============================================================================
+
+#define CLIENT_REACTOR_DEFAULT_SESSIONS 4096    // ⺻ ִ  
+#define CLIENT_REACTOR_ATTACH_TIMEOUT_MS 5000   // ̱/ Ϸ  ð
+#define CLIENT_REACTOR_SERVICE_ROUNDS   4       //  ϳ  óϴ ִ Ƚ
+#define CLIENT_REACTOR_TIMER_BATCH      1024    //   ó ִ  Ÿ̸ 
+
+//  û (chat_client_t.reactor_request)
+typedef enum {
+    CLIENT_REACTOR_REQUEST_NONE = 0,
+    CLIENT_REACTOR_REQUEST_ATTACH,      //  ߰
+    CLIENT_REACTOR_REQUEST_DETACH       //  
+} client_reactor_request_t;
+
+// =============================================================================
+//  ü
+// =============================================================================
+
+// Ÿ̸  ׸ ( reactor_timer_due ٸ ҵ ׸)
+typedef struct {
+    ULONGLONG due_ms;                   //  ð (utils_clock_now_ms )
+    chat_client_t* session;             //  
+} client_reactor_timer_t;
+
+//     ϳ ȭϴ ̺Ʈ 
+//  迭  迭  常 ϰ,
+// ٸ  ó  Ͽ  ְ   ˸
+typedef struct client_reactor_s {
+    HANDLE thread;                      //  
+    DWORD thread_id;                    //   ID
+    volatile int should_shutdown;       //  ÷
+    HANDLE ready_event;                 //  غ Ϸ
+
+    //  (sessions[i] <-> poll_fds[i + 1], poll_fds[0]  )
+    chat_client_t** sessions;
+    WSAPOLLFD* poll_fds;
+    int session_count;
+    int max_sessions;
+
+    // ٸ 忡 ó û  
+    SLIST_HEADER ready_list;
+
+    //  ( UDP Ͽ 1Ʈ )
+    SOCKET wake_socket;
+    volatile LONG wake_pending;         //   Ʈ  ó ʾ 1
+
+    // ƮƮ/翬 Ÿ̸ (ּ )
+    client_reactor_timer_t* timers;
+    int timer_count;
+    int timer_capacity;
+} client_reactor_t;
+
+// =============================================================================
+//  Լ
+// =============================================================================
+
+/**
+ *     
+ * @param max_sessions ִ   (0̸ ⺻)
+ * @return  νϽ,   NULL
+ */
+client_reactor_t* client_reactor_create(int max_sessions);
+
+/**
+ *     ( ִ    и)
+ * @param reactor  νϽ
+ */
+void client_reactor_destroy(client_reactor_t* reactor);
+
+/**
+ *  Ϳ  (client_start  ,  带  )
+ *   ̺Ʈ ݹ  忡 ȣ
+ * @param reactor  νϽ
+ * @param client   Ŭ̾Ʈ νϽ
+ * @return   0,   -1
+ */
+int client_reactor_attach(client_reactor_t* reactor, chat_client_t* client);
+
+/**
+ *  Ϳ  (client_shutdown ȣ)
+ *  (̺Ʈ ݹ) ȣ  
+ * @param reactor  νϽ
+ * @param client Ŭ̾Ʈ νϽ
+ * @return   0,   -1
+ */
+int client_reactor_detach(client_reactor_t* reactor, chat_client_t* client);
+
+/**
+ * ǿ ó /̺Ʈ  Ϳ ˸
+ * @param reactor  νϽ
+ * @param client Ŭ̾Ʈ νϽ
+ */
+void client_reactor_notify(client_reactor_t* reactor, chat_client_t* client);
+
+/**
+ *  پ ִ  
+ * @param reactor  νϽ
+ * @return  
+ */
+int client_reactor_session_count(const client_reactor_t* reactor);
+
+#endif // CLIENT_REACTOR_H
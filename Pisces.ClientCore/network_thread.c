@@ -0,0 +1,1205 @@
+#define LOG_MODULE LOG_MODULE_CLIENT
+
+#include "network_thread.h"
+#include <stdlib.h>
+#include <string.h>
+
+// =============================================================================
+//   Լ 
+// =============================================================================
+
+static int network_thread_initialize(chat_client_t* client);
+static void network_thread_cleanup(chat_client_t* client);
+static int network_thread_connect_to_server(chat_client_t* client, const char* host, uint16_t port);
+static int network_thread_continue_connect(chat_client_t* client);
+static int network_thread_send_auth_request(chat_client_t* client, const char* username);
+static int network_thread_send_resume_request(chat_client_t* client);
+static uint32_t network_thread_requested_capabilities(const chat_client_t* client);
+static int network_thread_handle_incoming_message(chat_client_t* client, message_t* message);
+static int network_thread_drain_commands(chat_client_t* client);
+static int network_thread_drain_socket(chat_client_t* client);
+static void network_thread_bind_socket_event(chat_client_t* client);
+static int network_thread_process_ui_command(chat_client_t* client, const ui_command_t* command);
+static int network_thread_send_chat_message(chat_client_t* client, const char* message);
+static int network_thread_flush_spool(chat_client_t* client);
+static void network_thread_acknowledge_spool(chat_client_t* client, uint32_t message_id);
+static void network_thread_clear_spool(chat_client_t* client);
+static int network_thread_request_user_list(chat_client_t* client);
+static int network_thread_send_heartbeat_ack(chat_client_t* client, uint32_t echo_us);
+static int network_thread_check_reconnect(chat_client_t* client);
+static void network_thread_schedule_reconnect(chat_client_t* client);
+static void network_thread_handle_connect_failure(chat_client_t* client, const char* reason);
+static void network_thread_handle_connection_lost(chat_client_t* client, const char* reason);
+
+// =============================================================================
+// Ʈũ   Լ
+// =============================================================================
+
+DWORD WINAPI client_network_thread_proc(LPVOID param) {
+    chat_client_t* client = (chat_client_t*)param;
+    if (!client) {
+        LOG_ERROR("Network thread: Invalid client parameter");
+        return 1;
+    }
+
+    LOG_INFO("Network thread started");
+
+    //  ʱȭ
+    if (network_thread_initialize(client) != 0) {
+        LOG_ERROR("Failed to initialize network thread");
+        return 1;
+    }
+
+    client->socket_event = WSACreateEvent();
+    if (client->socket_event == WSA_INVALID_EVENT) {
+        LOG_ERROR("Failed to create socket event (error %d)", WSAGetLastError());
+        network_thread_cleanup(client);
+        return 1;
+    }
+    client->bound_socket = INVALID_SOCKET;
+
+    // UI 忡 غ Ϸ ȣ
+    SetEvent(client->network_ready_event);
+
+    //  : غ ɰ  ͸  ó 
+    //  ̺Ʈ,  ť,  ̺Ʈ  ϳ ȣ  
+    while (!client->should_shutdown &&
+        WaitForSingleObject(client->shutdown_event, 0) != WAIT_OBJECT_0) {
+        utils_clock_update();
+
+        // UI  ó (/   ٲ  )
+        network_thread_drain_commands(client);
+        if (client->should_shutdown) {
+            break;
+        }
+
+        //    õ Ȯ   ּ õ 
+        network_thread_continue_connect(client);
+
+        network_thread_bind_socket_event(client);
+
+        //  ޽  ó ( ¿)
+        int more_input = network_thread_drain_socket(client);
+
+        //  翬 ð Ȯ
+        network_thread_check_reconnect(client);
+
+        network_thread_bind_socket_event(client);
+
+        if (more_input) {
+            continue;  //       ٽ ó
+        }
+
+        // 翬  ̸  õ ð 
+        DWORD wait_timeout = INFINITE;
+        if (client->config.auto_reconnect &&
+            client_get_current_state(client) == CLIENT_STATE_RECONNECTING) {
+            ULONGLONG now = utils_clock_now_ms();
+            wait_timeout = client->next_reconnect_ms <= now ? 0 : (DWORD)(client->next_reconnect_ms - now);
+        }
+
+        //  ߿  ּ õ ð Ǵ  ŸӾƿ 
+        int connect_timeout = network_connector_next_timeout(&client->connector);
+        if (connect_timeout >= 0 && (DWORD)connect_timeout < wait_timeout) {
+            wait_timeout = (DWORD)connect_timeout;
+        }
+
+        HANDLE wait_handles[3];
+        DWORD handle_count = 0;
+        wait_handles[handle_count++] = client->shutdown_event;
+
+        HANDLE command_handle = command_queue_begin_wait(client->command_queue);
+        if (!command_handle) {
+            command_queue_end_wait(client->command_queue);
+            continue;  //  ̿  
+        }
+        wait_handles[handle_count++] = command_handle;
+
+        if (client->bound_socket != INVALID_SOCKET || client->connector.active) {
+            //  ̸ õ ϵ FD_CONNECT  ̺Ʈ ȣ
+            wait_handles[handle_count++] = client->socket_event;
+        }
+        else if (client->server_socket && client_is_connected(client) &&
+            wait_timeout > NETWORK_THREAD_TIMEOUT_MS) {
+            // ̺Ʈ ῡ   ª ֱ 
+            wait_timeout = NETWORK_THREAD_TIMEOUT_MS;
+        }
+
+        WaitForMultipleObjects(handle_count, wait_handles, FALSE, wait_timeout);
+        command_queue_end_wait(client->command_queue);
+
+        //  ̺Ʈ  ( recv   Ͱ  ٽ ȣ)
+        if (client->bound_socket != INVALID_SOCKET) {
+            WSANETWORKEVENTS network_events;
+            WSAEnumNetworkEvents(client->bound_socket, client->socket_event, &network_events);
+        }
+        else if (client->connector.active) {
+            WSAResetEvent(client->socket_event);  // Ϸ δ network_connector_poll Ȯ
+        }
+    }
+
+    WSACloseEvent(client->socket_event);
+    client->socket_event = WSA_INVALID_EVENT;
+    client->bound_socket = INVALID_SOCKET;
+
+    // 
+    network_thread_cleanup(client);
+
+    LOG_INFO("Network thread exiting");
+    return 0;
+}
+
+// =============================================================================
+//   ó Լ
+// =============================================================================
+
+int client_session_open(chat_client_t* client) {
+    return network_thread_initialize(client);
+}
+
+void client_session_close(chat_client_t* client) {
+    network_thread_cleanup(client);
+}
+
+int client_session_process_commands(chat_client_t* client) {
+    if (!client) {
+        return 0;
+    }
+
+    return network_thread_drain_commands(client);
+}
+
+int client_session_process_input(chat_client_t* client) {
+    if (!client) {
+        return 0;
+    }
+
+    if (client->connector.active) {
+        network_thread_continue_connect(client);
+        return 0;
+    }
+
+    return network_thread_drain_socket(client);
+}
+
+void client_session_process_timers(chat_client_t* client) {
+    if (!client) {
+        return;
+    }
+
+    // ƮƮ ŸӾƿ (  忡 client_poll ˻)
+    if (client_is_connected(client) &&
+        utils_clock_elapsed_ms(client->last_heartbeat, utils_clock_now_ms()) >
+        (uint64_t)client->config.heartbeat_timeout * 1000) {
+        LOG_WARNING("Heartbeat timeout detected");
+        client_set_last_error(client, "Heartbeat timeout");
+
+        ui_command_t disconnect_cmd = { 0 };
+        disconnect_cmd.type = UI_CMD_DISCONNECT;
+        utils_string_copy(disconnect_cmd.data, sizeof(disconnect_cmd.data), "Heartbeat timeout");
+        network_thread_process_ui_command(client, &disconnect_cmd);
+    }
+
+    //  ּ õ ð Ǵ  ŸӾƿ
+    network_thread_continue_connect(client);
+
+    network_thread_check_reconnect(client);
+}
+
+SOCKET client_session_poll_handle(chat_client_t* client, short* events) {
+    if (!client) {
+        return INVALID_SOCKET;
+    }
+
+    //  ߿  ֱ õ Ϸ( /) ٸ
+    if (client->connector.active) {
+        if (events) {
+            *events = POLLWRNORM;
+        }
+        return network_connector_watch_handle(&client->connector);
+    }
+
+    if (events) {
+        *events = POLLRDNORM;
+    }
+
+    if (!client->server_socket || !client_is_connected(client)) {
+        return INVALID_SOCKET;
+    }
+
+    return client->server_socket->handle;
+}
+
+// =============================================================================
+// ʱȭ  
+// =============================================================================
+
+static int network_thread_initialize(chat_client_t* client) {
+    if (!client) {
+        return -1;
+    }
+
+    // Ʈũ ʱȭ Ȯ
+    if (!network_is_initialized()) {
+        if (network_initialize() != NETWORK_SUCCESS) {
+            LOG_ERROR("Failed to initialize network in thread");
+            return -1;
+        }
+    }
+
+    LOG_DEBUG("Network thread initialized");
+    return 0;
+}
+
+static void network_thread_cleanup(chat_client_t* client) {
+    if (!client) {
+        return;
+    }
+
+    //    õ     
+    network_connector_cancel(&client->connector);
+
+    if (client->server_socket) {
+        network_socket_close(client->server_socket);
+        network_socket_destroy(client->server_socket);
+        client->server_socket = NULL;
+    }
+
+    network_thread_clear_spool(client);
+
+    LOG_DEBUG("Network thread cleaned up");
+}
+
+// =============================================================================
+//   Լ
+// =============================================================================
+
+static int network_thread_connect_to_server(chat_client_t* client, const char* host, uint16_t port) {
+    if (!client || utils_string_is_empty(host) || port == 0) {
+        return -1;
+    }
+
+    LOG_INFO("Attempting to connect to %s:%d", host, port);
+
+    //   
+    if (client->server_socket) {
+        network_socket_close(client->server_socket);
+        network_socket_destroy(client->server_socket);
+        client->server_socket = NULL;
+    }
+    client->bound_socket = INVALID_SOCKET;  //    ڵ    
+
+    //  ּҷ  ΰ  õ (Ϸ   ̺Ʈ Ȯ)
+    network_result_t start_result = network_connector_start(&client->connector, host, port,
+        client->config.connect_timeout * 1000, client->socket_event);
+    if (start_result != NETWORK_WOULD_BLOCK) {
+        LOG_ERROR("Connection failed: %s", network_result_to_string(start_result));
+        network_thread_handle_connect_failure(client, network_result_to_string(start_result));
+        return -1;
+    }
+
+    return network_thread_continue_connect(client) < 0 ? -1 : 0;
+}
+
+static int network_thread_continue_connect(chat_client_t* client) {
+    if (!client->connector.active) {
+        return 0;
+    }
+
+    network_socket_t* connected = NULL;
+    network_result_t result = network_connector_poll(&client->connector, &connected);
+
+    if (result == NETWORK_WOULD_BLOCK) {
+        return 0;  //   
+    }
+
+    if (result != NETWORK_SUCCESS) {
+        //  ּ  Ǵ ŸӾƿ
+        network_thread_handle_connect_failure(client,
+            result == NETWORK_TIMEOUT ? "Connection timeout" : network_result_to_string(result));
+        return -1;
+    }
+
+    client->server_socket = connected;
+    client_notify_connection_result(client, 1, NULL);
+
+    // 翬̸  ٷ  (TCP  ǹǷ  ʿ)
+    // 簳 ū     ģ ޽ 
+    if (client->auth_after_connect && !utils_string_is_empty(client->config.username)) {
+        client_change_state(client, CLIENT_STATE_AUTHENTICATING, CLIENT_EVENT_AUTH_REQUESTED);
+        if (!utils_string_is_empty(client->resume_token)) {
+            network_thread_send_resume_request(client);
+        }
+        else {
+            network_thread_send_auth_request(client, client->config.username);
+        }
+    }
+
+    return 1;
+}
+
+static int network_thread_send_auth_request(chat_client_t* client, const char* username) {
+    if (!client || utils_string_is_empty(username) || !client->server_socket) {
+        return -1;
+    }
+
+    if (client->auth_pending) {
+        LOG_WARNING("Authentication request already in progress");
+        return -1;
+    }
+
+    LOG_INFO("Sending authentication request for '%s'", username);
+
+    //  û ޽ 
+    message_t* auth_msg = message_create_connect_request(username,
+        network_thread_requested_capabilities(client));
+    if (!auth_msg) {
+        LOG_ERROR("Failed to create authentication message");
+        client_notify_auth_result(client, 0, "Failed to create auth message");
+        return -1;
+    }
+
+    // ޽ 
+    network_result_t send_result = network_socket_send_message(client->server_socket, auth_msg);
+    message_destroy(auth_msg);
+
+    if (send_result != NETWORK_SUCCESS) {
+        LOG_ERROR("Failed to send authentication message: %s",
+            network_result_to_string(send_result));
+        client_notify_auth_result(client, 0, "Failed to send auth message");
+        return -1;
+    }
+
+    client->auth_pending = 1;
+    LOG_DEBUG("Authentication request sent");
+    return 0;
+}
+
+static int network_thread_send_resume_request(chat_client_t* client) {
+    LOG_INFO("Resuming session for '%s' (last sequence %u)", client->config.username, client->last_sequence);
+
+    message_t* resume_msg = message_create_session_resume(client->config.username,
+        client->resume_token, client->last_sequence,
+        network_thread_requested_capabilities(client));
+    if (!resume_msg) {
+        return network_thread_send_auth_request(client, client->config.username);
+    }
+
+    network_result_t send_result = network_socket_send_message(client->server_socket, resume_msg);
+    message_destroy(resume_msg);
+
+    if (send_result != NETWORK_SUCCESS) {
+        LOG_ERROR("Failed to send resume request: %s", network_result_to_string(send_result));
+        client_notify_auth_result(client, 0, "Failed to send resume request");
+        return -1;
+    }
+
+    client->auth_pending = 1;
+    return 0;
+}
+
+// =============================================================================
+// ޽ ó Լ
+// =============================================================================
+
+static uint32_t network_thread_requested_capabilities(const chat_client_t* client) {
+    uint32_t capabilities = 0;
+    if (client->config.enable_compression) {
+        capabilities |= PROTOCOL_CAP_COMPRESSION;
+    }
+    if (client->config.enable_compact_header) {
+        capabilities |= PROTOCOL_CAP_COMPACT_HEADER;
+    }
+
+    //  Ӱ /  ׻ ó  
+    capabilities |= PROTOCOL_CAP_BATCH | PROTOCOL_CAP_PRESENCE_DIGEST;
+    return capabilities;
+}
+
+static int network_thread_handle_incoming_message(chat_client_t* client, message_t* message) {
+    if (!client || !message) {
+        return -1;
+    }
+
+    message_type_t msg_type = (message_type_t)ntohs(message->header.type);
+
+    LOG_DEBUG("Handling incoming message type: %s", message_type_to_string(msg_type));
+
+    switch (msg_type) {
+    case MSG_BATCH:
+    {
+        // ׸  ̷ε带 ״ ŰǷ ׸񸶴 Ҵ 
+        message_t item;
+        uint32_t offset = 0;
+        int result;
+
+        while ((result = message_batch_next(message, &offset, &item)) == 1) {
+            network_thread_handle_incoming_message(client, &item);
+
+            // ׸ ó     
+            if (!client->server_socket || !client_is_connected(client)) {
+                break;
+            }
+        }
+
+        if (result < 0) {
+            LOG_WARNING("Malformed batch frame at offset %u", offset);
+        }
+    }
+    break;
+
+    case MSG_CONNECT_RESPONSE:
+    {
+        //  Ŀ     Ƿ ٽ   
+        client->auth_pending = 0;
+
+        uint32_t payload_size = ntohl(message->header.payload_size);
+        if (payload_size >= CONNECT_RESPONSE_MIN_SIZE) {
+            connect_response_payload_t* response = (connect_response_payload_t*)message->payload;
+            response_code_t result = (response_code_t)ntohl(response->result);
+            uint32_t capabilities = payload_size >= sizeof(connect_response_payload_t) ?
+                ntohl(response->capabilities) : 0;  //     
+
+            if (result == RESPONSE_SUCCESS) {
+                LOG_INFO("Authentication successful");
+
+                //     Ӻ ؼ 
+                if ((capabilities & PROTOCOL_CAP_COMPRESSION) &&
+                    network_socket_enable_compression(client->server_socket) != NETWORK_SUCCESS) {
+                    LOG_ERROR("Failed to prepare decompression");
+                }
+
+                //      Ӻ  
+                if (capabilities & PROTOCOL_CAP_COMPACT_HEADER) {
+                    network_socket_enable_compact_header(client->server_socket);
+                }
+
+                client_notify_auth_result(client, 1, response->message);
+
+                //    ó ٽ 
+                client->reconnect_delay_ms = 0;
+                client->retry_after_ms = 0;
+
+                // 翬   äð Ȯι  ä   ٽ 
+                network_thread_flush_spool(client);
+            }
+            else {
+                LOG_WARNING("Authentication failed: %s", response->message);
+                client_notify_auth_result(client, 0, response->message);
+            }
+        }
+        else {
+            LOG_ERROR("Invalid connect response payload size");
+            client_notify_auth_result(client, 0, "Invalid server response");
+        }
+    }
+    break;
+
+    case MSG_CHAT_BROADCAST:
+    {
+        if (ntohl(message->header.payload_size) >= sizeof(chat_message_payload_t)) {
+            chat_message_payload_t* chat = (chat_message_payload_t*)message->payload;
+            time_t timestamp = (time_t)ntohl(chat->timestamp);
+
+            // 簳  ̹  ޽ ٽ ǥ  ( 0    ȳ)
+            uint32_t sequence = ntohl(chat->sequence);
+            if (sequence != 0) {
+                if (sequence <= client->last_sequence) {
+                    break;
+                }
+                client->last_sequence = sequence;
+            }
+
+            // ڱ ޽ ڴ  ޾Ҵٴ Ȯ
+            uint32_t message_id = ntohl(chat->message_id);
+            if (message_id != 0 && strcmp(chat->sender_name, client->config.username) == 0) {
+                network_thread_acknowledge_spool(client, message_id);
+            }
+
+            client_notify_chat_received(client, chat->sender_name, chat->message, timestamp);
+        }
+        else {
+            LOG_WARNING("Invalid chat message payload size");
+        }
+    }
+    break;
+
+    case MSG_SESSION_TOKEN:
+    {
+        if (ntohl(message->header.payload_size) >= sizeof(session_token_payload_t)) {
+            session_token_payload_t* token = (session_token_payload_t*)message->payload;
+            token->token[SESSION_TOKEN_LENGTH] = '\0';
+            utils_string_copy(client->resume_token, sizeof(client->resume_token), token->token);
+
+            // ó ϸ   ޽   ƴ
+            uint32_t last_sequence = ntohl(token->last_sequence);
+            if (client->last_sequence < last_sequence) {
+                client->last_sequence = last_sequence;
+            }
+            LOG_DEBUG("Received session resume token");
+        }
+    }
+    break;
+
+    case MSG_USER_LIST_RESPONSE:
+    {
+        uint32_t payload_size = ntohl(message->header.payload_size);
+        LOG_INFO("Received user list response, payload size: %d", payload_size);
+
+        if (payload_size > 0) {
+            char* user_list = (char*)malloc(payload_size + 1);
+            if (user_list) {
+                memcpy(user_list, message->payload, payload_size);
+                user_list[payload_size] = '\0';
+
+                LOG_INFO("User list content: %s", user_list);
+                client_notify_user_list(client, user_list);
+                free(user_list);
+            }
+        }
+    }
+    break;
+
+    case MSG_USER_JOINED:
+    {
+        uint32_t payload_size = ntohl(message->header.payload_size);
+        if (payload_size > 0 && payload_size < MAX_USERNAME_LENGTH) {
+            char username[MAX_USERNAME_LENGTH];
+            memcpy(username, message->payload, payload_size);
+            username[payload_size] = '\0';
+
+            client_notify_user_joined(client, username);
+        }
+    }
+    break;
+
+    case MSG_USER_LEFT:
+    {
+        uint32_t payload_size = ntohl(message->header.payload_size);
+        if (payload_size > 0 && payload_size < MAX_USERNAME_LENGTH) {
+            char username[MAX_USERNAME_LENGTH];
+            memcpy(username, message->payload, payload_size);
+            username[payload_size] = '\0';
+
+            client_notify_user_left(client, username);
+        }
+    }
+    break;
+
+    case MSG_USER_PRESENCE:
+    {
+        // "+a,+b,-c" ״  ڸ / ˸ (ڱ ڽ )
+        const char* cursor = message->payload;
+        const char* end = cursor + ntohl(message->header.payload_size);
+
+        while (cursor && cursor < end) {
+            const char* separator = (const char*)memchr(cursor, PRESENCE_DIGEST_SEPARATOR, (size_t)(end - cursor));
+            const char* entry_end = separator ? separator : end;
+            size_t name_length = (size_t)(entry_end - cursor) - 1;
+
+            if (entry_end - cursor >= 2 && name_length < MAX_USERNAME_LENGTH) {
+                char username[MAX_USERNAME_LENGTH];
+                memcpy(username, cursor + 1, name_length);
+                username[name_length] = '\0';
+
+                if (strcmp(username, client->config.username) != 0) {
+                    if (cursor[0] == PRESENCE_DIGEST_JOINED) {
+                        client_notify_user_joined(client, username);
+                    }
+                    else if (cursor[0] == PRESENCE_DIGEST_LEFT) {
+                        client_notify_user_left(client, username);
+                    }
+                }
+            }
+
+            cursor = entry_end + 1;
+        }
+    }
+    break;
+
+    case MSG_HEARTBEAT:
+    {
+        //  ð ״   պ ð   (  ̷ε尡 )
+        uint32_t echo_us = 0;
+        if (ntohl(message->header.payload_size) >= sizeof(heartbeat_payload_t)) {
+            const heartbeat_payload_t* heartbeat = (const heartbeat_payload_t*)message->payload;
+            echo_us = ntohl(heartbeat->timestamp_us);
+        }
+
+        LOG_DEBUG("Received heartbeat, sending ACK");
+        network_thread_send_heartbeat_ack(client, echo_us);
+    }
+    break;
+
+    case MSG_HEARTBEAT_ACK:
+    {
+        // 츮 ACK  ð   
+        if (ntohl(message->header.payload_size) >= sizeof(heartbeat_payload_t)) {
+            const heartbeat_payload_t* ack = (const heartbeat_payload_t*)message->payload;
+            uint32_t echo_us = ntohl(ack->echo_us);
+            if (echo_us != 0) {
+                network_rtt_update(&client->stats.rtt, network_rtt_elapsed_ms(echo_us));
+            }
+        }
+    }
+    break;
+
+    case MSG_DISCONNECT:
+    {
+        LOG_INFO("Server requested disconnect");
+        network_thread_handle_connection_lost(client, "Server requested disconnect");
+    }
+    break;
+
+    case MSG_ERROR_SERVER_FULL:
+    {
+        //  ˷ ð  ٽ   (   )
+        if (ntohl(message->header.payload_size) >= sizeof(error_payload_t)) {
+            error_payload_t* error = (error_payload_t*)message->payload;
+            error->error_message[sizeof(error->error_message) - 1] = '\0';
+
+            uint32_t retry_after_sec = ntohl(error->error_context);
+            if (retry_after_sec > CLIENT_RECONNECT_MAX_DELAY) {
+                retry_after_sec = CLIENT_RECONNECT_MAX_DELAY;
+            }
+            client->retry_after_ms = retry_after_sec * 1000;
+
+            LOG_WARNING("Server is full, retrying after %u seconds", retry_after_sec);
+            client_set_last_error(client, error->error_message);
+        }
+    }
+    break;
+
+    case MSG_ERROR_GENERIC:
+    case MSG_ERROR_PROTOCOL:
+    case MSG_ERROR_AUTH:
+    case MSG_ERROR_PERMISSION:
+    {
+        uint32_t payload_size = ntohl(message->header.payload_size);
+        if (payload_size > 0) {
+            char error_msg[512];
+            const char* error_text = message->payload;
+            size_t error_length = payload_size;
+
+            //   ̷ε ڵ ڿ ڿ 
+            if (payload_size >= sizeof(error_payload_t)) {
+                error_payload_t* error = (error_payload_t*)message->payload;
+                error_text = error->error_message;
+                error_length = strnlen(error->error_message, sizeof(error->error_message));
+            }
+
+            size_t copy_size = (error_length < sizeof(error_msg) - 1) ? error_length : sizeof(error_msg) - 1;
+            memcpy(error_msg, error_text, copy_size);
+            error_msg[copy_size] = '\0';
+
+            LOG_ERROR("Server error (%s): %s",
+                message_type_to_string(msg_type), error_msg);
+
+            //  ¿   ˸
+            client_state_t state = client_get_current_state(client);
+            if (state == CLIENT_STATE_AUTHENTICATING) {
+                client_notify_auth_result(client, 0, error_msg);
+            }
+            else {
+                client_set_last_error(client, error_msg);
+            }
+        }
+    }
+    break;
+
+    default:
+        LOG_WARNING("Unknown message type received: %d", msg_type);
+        break;
+    }
+
+    return 0;
+}
+
+static int network_thread_drain_commands(chat_client_t* client) {
+    ui_command_t command;
+    int processed = 0;
+
+    while (!client->should_shutdown &&
+        command_queue_pop(client->command_queue, &command, 0) == 0) {
+        if (network_thread_process_ui_command(client, &command) != 0) {
+            LOG_DEBUG("Failed to process UI command type %d", command.type);
+        }
+        processed++;
+    }
+
+    return processed;
+}
+
+static int network_thread_drain_socket(chat_client_t* client) {
+    int budget = NETWORK_THREAD_RECV_BUDGET;
+
+    while (budget > 0 && client->server_socket && client_is_connected(client)) {
+        //  Ͱ ִ Ȯ
+        if (network_socket_has_data(client->server_socket, 0) != 1) {
+            return 0;
+        }
+
+        message_t* received_msg = network_socket_recv_message(client->server_socket);
+        if (!received_msg) {
+            // ޽   -   ɼ
+            if (!network_socket_is_connected(client->server_socket)) {
+                network_thread_handle_connection_lost(client, "Connection lost during message receive");
+            }
+            return 0;
+        }
+
+        client->last_heartbeat = utils_clock_now_ms();  // Ȱ 
+
+        if (network_thread_handle_incoming_message(client, received_msg) != 0) {
+            LOG_DEBUG("Failed to handle incoming message");
+        }
+
+        message_destroy(received_msg);
+        budget--;
+    }
+
+    return budget == 0;
+}
+
+static void network_thread_bind_socket_event(chat_client_t* client) {
+    SOCKET handle = INVALID_SOCKET;
+    if (client->server_socket && client_is_connected(client)) {
+        handle = client->server_socket->handle;
+    }
+
+    if (handle == client->bound_socket) {
+        return;
+    }
+
+    //  ٲ   ȣ   Ͽ ٽ 
+    WSAResetEvent(client->socket_event);
+    client->bound_socket = INVALID_SOCKET;
+
+    if (handle != INVALID_SOCKET) {
+        if (WSAEventSelect(handle, client->socket_event, FD_READ | FD_CLOSE) == SOCKET_ERROR) {
+            LOG_WARNING("WSAEventSelect failed (error %d)", WSAGetLastError());
+            return;
+        }
+        client->bound_socket = handle;
+    }
+}
+
+static int network_thread_process_ui_command(chat_client_t* client, const ui_command_t* command) {
+    if (!client || !command) {
+        return -1;
+    }
+
+    LOG_DEBUG("Processing UI command type: %d", command->type);
+
+    switch (command->type) {
+    case UI_CMD_CONNECT:
+    {
+        //   Ľ (host:port Ǵ username)
+        client_state_t state = client_get_current_state(client);
+
+        if (state == CLIENT_STATE_CONNECTING) {
+            // ȣƮ:Ʈ Ľ
+            char host_port[256];
+            utils_string_copy(host_port, sizeof(host_port), command->data);
+
+            char* colon_pos = strchr(host_port, ':');
+            if (colon_pos) {
+                *colon_pos = '\0';
+                char* host = host_port;
+                uint16_t port = (uint16_t)atoi(colon_pos + 1);
+
+                client->auth_after_connect = 0;  //  Ʈ尡  Ϸ  û
+                client->resume_token[0] = '\0';   //    
+                client->last_sequence = 0;
+                network_thread_clear_spool(client);
+                return network_thread_connect_to_server(client, host, port);
+            }
+        }
+    }
+    break;
+
+    case UI_CMD_AUTHENTICATE:
+    {
+        return network_thread_send_auth_request(client, command->data);
+    }
+    break;
+
+    case UI_CMD_DISCONNECT:
+    {
+        //    ̻(ƮƮ ŸӾƿ ),   û
+        int user_requested = utils_string_is_empty(command->data);
+        const char* reason = user_requested ? "User requested disconnect" : command->data;
+
+        if (client->connector.active) {
+            //    õ 
+            network_connector_cancel(&client->connector);
+            network_thread_handle_connection_lost(client, reason);
+        }
+        else if (client->server_socket) {
+            //   ޽  ( ̸̻   ϵ  )
+            //   ٸ ̸      Ƿ Ḹ 
+            message_t* disconnect_msg = user_requested && !client->auth_pending ?
+                message_create(MSG_DISCONNECT, NULL, 0) : NULL;
+            if (disconnect_msg) {
+                network_socket_send_message(client->server_socket, disconnect_msg);
+                message_destroy(disconnect_msg);
+            }
+
+            network_thread_handle_connection_lost(client, reason);
+        }
+
+        //     簳   
+        if (user_requested) {
+            client->resume_token[0] = '\0';
+            network_thread_clear_spool(client);
+        }
+    }
+    break;
+
+    case UI_CMD_SEND_CHAT:
+        return network_thread_send_chat_message(client, command->data);
+
+    case UI_CMD_REQUEST_USER_LIST:
+        return network_thread_request_user_list(client);
+
+    case UI_CMD_SHUTDOWN:
+        LOG_INFO("Shutdown command received");
+        client->should_shutdown = 1;
+        break;
+
+    default:
+        LOG_WARNING("Unknown UI command type: %d", command->type);
+        return -1;
+    }
+
+    return 0;
+}
+
+static int network_thread_send_chat_message(chat_client_t* client, const char* message) {
+    if (!client || utils_string_is_empty(message)) {
+        return -1;
+    }
+
+    //   翬    (ó   Ϸؾ )
+    int authenticated = client_is_authenticated(client);
+    if (!authenticated && client_get_current_state(client) != CLIENT_STATE_RECONNECTING &&
+        !client->auth_after_connect) {
+        LOG_ERROR("Cannot send chat message: not authenticated");
+        return -1;
+    }
+
+    client_outbound_spool_t* spool = &client->spool;
+    if (spool->count == CLIENT_SPOOL_CAPACITY) {
+        client_spool_entry_t* oldest = &spool->entries[spool->head];
+        if (!oldest->sent) {
+            LOG_WARNING("Outbound spool is full, dropping chat message");
+            client_set_last_error(client, "Too many messages waiting for reconnection");
+            return -1;
+        }
+
+        // ̹  ׸ Ȯθ   ̹Ƿ   ͺ 
+        free(oldest->text);
+        oldest->text = NULL;
+        spool->head = (spool->head + 1) % CLIENT_SPOOL_CAPACITY;
+        spool->count--;
+    }
+
+    size_t length = strlen(message);
+    char* text = (char*)malloc(length + 1);
+    if (!text) {
+        LOG_ERROR("Failed to allocate memory for chat message");
+        return -1;
+    }
+    memcpy(text, message, length + 1);
+
+    client_spool_entry_t* entry = &spool->entries[(spool->head + spool->count) % CLIENT_SPOOL_CAPACITY];
+    entry->message_id = ++spool->next_message_id;
+    entry->text = text;
+    entry->sent = 0;
+    spool->count++;
+
+    if (!authenticated) {
+        LOG_DEBUG("Spooled chat message %u until reconnected (%d waiting)", entry->message_id, spool->count);
+        return 0;
+    }
+
+    LOG_DEBUG("Sending chat message: %s", message);
+    return network_thread_flush_spool(client) < 0 ? -1 : 0;
+}
+
+// =============================================================================
+// ۽  ä (翬  ,     )
+// =============================================================================
+
+static int network_thread_flush_spool(chat_client_t* client) {
+    client_outbound_spool_t* spool = &client->spool;
+    if (spool->count == 0 || !client->server_socket || client->auth_pending) {
+        return 0;  //   ٸ ̸  ó  
+    }
+
+    // ڵ带 ִ ũ ӿ ä ְ, ӵ ̾ ٿ   
+    // ڵ ϳ ׻  ϳ Ƿ   ׸   
+    const size_t payload_capacity = MAX_MESSAGE_SIZE - sizeof(message_header_t);
+    char* out = (char*)malloc((size_t)spool->count * MAX_MESSAGE_SIZE);
+    char* payload = (char*)malloc(payload_capacity);
+    if (!out || !payload) {
+        free(out);
+        free(payload);
+        LOG_ERROR("Failed to allocate spool flush buffer");
+        return -1;
+    }
+
+    size_t out_length = 0;
+    size_t payload_length = 0;
+    int flushed = 0;
+    int frames = 0;
+    int result = 0;
+
+    for (int i = 0; i <= spool->count; i++) {
+        client_spool_entry_t* entry = i < spool->count ?
+            &spool->entries[(spool->head + i) % CLIENT_SPOOL_CAPACITY] : NULL;
+        if (entry && entry->sent) {
+            continue;
+        }
+
+        int appended = entry ?
+            message_append_chat_record(payload, payload_capacity, payload_length, entry->message_id, entry->text) : -1;
+
+        //  áų ̸ ݱ ڵ带  ϳ ȭ
+        if (appended < 0 && payload_length > 0) {
+            message_t* frame = message_create(MSG_CHAT_SUBMIT, payload, (uint32_t)payload_length);
+            int frame_length = frame ?
+                network_socket_serialize_message(client->server_socket, frame, out + out_length, MAX_MESSAGE_SIZE) : -1;
+            message_destroy(frame);
+            if (frame_length < 0) {
+                result = -1;
+                break;
+            }
+            out_length += (size_t)frame_length;
+            payload_length = 0;
+            frames++;
+
+            if (entry) {
+                appended = message_append_chat_record(payload, payload_capacity, 0, entry->message_id, entry->text);
+            }
+        }
+
+        if (entry && appended >= 0) {
+            payload_length = (size_t)appended;
+            flushed++;
+        }
+    }
+
+    free(payload);
+
+    if (result == 0 && out_length > 0) {
+        network_result_t send_result = network_socket_send_all(client->server_socket, out, (int)out_length);
+        if (send_result != NETWORK_SUCCESS) {
+            LOG_ERROR("Failed to send chat message: %s", network_result_to_string(send_result));
+
+            if (send_result == NETWORK_DISCONNECTED) {
+                network_thread_handle_connection_lost(client, "Connection lost during chat send");
+            }
+            result = -1;
+        }
+    }
+    free(out);
+
+    if (result != 0) {
+        return -1;
+    }
+
+    //  ڷ Ȯε   ( ٽ )
+    for (int i = 0; i < spool->count; i++) {
+        spool->entries[(spool->head + i) % CLIENT_SPOOL_CAPACITY].sent = 1;
+    }
+
+    if (flushed > 1) {
+        LOG_INFO("Flushed %d spooled chat messages in %d frame(s), %zu bytes", flushed, frames, out_length);
+    }
+
+    return flushed;
+}
+
+static void network_thread_acknowledge_spool(chat_client_t* client, uint32_t message_id) {
+    client_outbound_spool_t* spool = &client->spool;
+
+    //  ID  óϹǷ Ȯι ID ϴ  ޵ 
+    while (spool->count > 0) {
+        client_spool_entry_t* entry = &spool->entries[spool->head];
+        if (entry->message_id > message_id || !entry->sent) {
+            break;
+        }
+
+        free(entry->text);
+        entry->text = NULL;
+        spool->head = (spool->head + 1) % CLIENT_SPOOL_CAPACITY;
+        spool->count--;
+    }
+}
+
+static void network_thread_clear_spool(chat_client_t* client) {
+    client_outbound_spool_t* spool = &client->spool;
+
+    for (int i = 0; i < spool->count; i++) {
+        client_spool_entry_t* entry = &spool->entries[(spool->head + i) % CLIENT_SPOOL_CAPACITY];
+        free(entry->text);
+        entry->text = NULL;
+    }
+
+    spool->head = 0;
+    spool->count = 0;
+}
+
+static int network_thread_request_user_list(chat_client_t* client) {
+    if (!client || !client->server_socket) {
+        return -1;
+    }
+
+    if (!client_is_authenticated(client) || client->auth_pending) {
+        LOG_ERROR("Cannot request user list: not authenticated");
+        return -1;
+    }
+
+    LOG_DEBUG("Requesting user list");
+
+    //   û ޽ 
+    message_t* userlist_msg = message_create(MSG_USER_LIST_REQUEST, NULL, 0);
+    if (!userlist_msg) {
+        LOG_ERROR("Failed to create user list request message");
+        return -1;
+    }
+
+    // ޽ 
+    network_result_t send_result = network_socket_send_message(client->server_socket, userlist_msg);
+    message_destroy(userlist_msg);
+
+    if (send_result != NETWORK_SUCCESS) {
+        LOG_ERROR("Failed to send user list request: %s", network_result_to_string(send_result));
+
+        if (send_result == NETWORK_DISCONNECTED) {
+            network_thread_handle_connection_lost(client, "Connection lost during user list request");
+        }
+        return -1;
+    }
+
+    return 0;
+}
+
+static int network_thread_send_heartbeat_ack(chat_client_t* client, uint32_t echo_us) {
+    if (!client || !client->server_socket || client->auth_pending) {
+        return -1;
+    }
+
+    // ƮƮ ACK ޽  ( ð ְ,  ٽ  츮 ð )
+    message_t* heartbeat_ack = message_create_heartbeat(MSG_HEARTBEAT_ACK,
+        echo_us != 0 ? network_rtt_timestamp() : 0, echo_us);
+    if (!heartbeat_ack) {
+        LOG_ERROR("Failed to create heartbeat ACK message");
+        return -1;
+    }
+
+    // ޽ 
+    network_result_t send_result = network_socket_send_message(client->server_socket, heartbeat_ack);
+    message_destroy(heartbeat_ack);
+
+    if (send_result == NETWORK_SUCCESS) {
+        //   δ  θ ǴϹǷ last_heartbeat ǵ帮 
+        LOG_DEBUG("Heartbeat ACK sent");
+        return 0;
+    }
+    else {
+        LOG_DEBUG("Failed to send heartbeat ACK: %s", network_result_to_string(send_result));
+
+        if (send_result == NETWORK_DISCONNECTED) {
+            network_thread_handle_connection_lost(client, "Connection lost during heartbeat ACK");
+        }
+        return -1;
+    }
+}
+
+// =============================================================================
+// 翬    
+// =============================================================================
+
+static int network_thread_check_reconnect(chat_client_t* client) {
+    if (!client || !client->config.auto_reconnect) {
+        return 0;
+    }
+
+    client_state_t state = client_get_current_state(client);
+
+    // 翬 ʿ ̰  ð  Ȯ
+    if (state == CLIENT_STATE_RECONNECTING && utils_clock_now_ms() >= client->next_reconnect_ms) {
+        LOG_INFO("Attempting to reconnect...");
+
+        // 翬 õ (Ǹ network_thread_continue_connect  )
+        client->auth_after_connect = 1;
+        network_thread_connect_to_server(client,
+            client->config.server_host,
+            client->config.server_port);
+    }
+
+    return 0;
+}
+
+static void network_thread_schedule_reconnect(chat_client_t* client) {
+    //    : ⺻ ݰ   3 ̿  
+    //     Ŭ̾Ʈ  ֱ  ʰ  
+    DWORD base_ms = (DWORD)client->config.reconnect_interval * 1000;
+    DWORD previous_ms = client->reconnect_delay_ms > base_ms ? client->reconnect_delay_ms : base_ms;
+    DWORD delay_ms = utils_random_between(base_ms, previous_ms * 3);
+    if (delay_ms > CLIENT_RECONNECT_MAX_DELAY * 1000) {
+        delay_ms = CLIENT_RECONNECT_MAX_DELAY * 1000;
+    }
+
+    //  ȭ · ˷ ð  õ  ( ̹  л)
+    if (delay_ms < client->retry_after_ms) {
+        delay_ms = client->retry_after_ms;
+    }
+    client->retry_after_ms = 0;
+
+    client->reconnect_delay_ms = delay_ms;
+    client->next_reconnect_ms = utils_clock_now_ms() + delay_ms;
+    LOG_DEBUG("Next reconnect attempt in %lu ms", (unsigned long)delay_ms);
+}
+
+static void network_thread_handle_connect_failure(chat_client_t* client, const char* reason) {
+    // 翬 ̸  õ ϰ 翬 · ǵ
+    int retry = client->auth_after_connect && client->config.auto_reconnect && !client->should_shutdown;
+    if (retry) {
+        network_thread_schedule_reconnect(client);
+    }
+
+    client_notify_connection_result(client, 0, reason);
+
+    if (retry) {
+        client_change_state(client, CLIENT_STATE_RECONNECTING, CLIENT_EVENT_RECONNECT_REQUESTED);
+    }
+}
+
+static void network_thread_handle_connection_lost(chat_client_t* client, const char* reason) {
+    if (!client) {
+        return;
+    }
+
+    LOG_WARNING("Handling connection lost: %s", reason ? reason : "Unknown");
+    client->auth_pending = 0;
+
+    //  Ȯι  ä   ٽ  ( ID ߺ )
+    for (int i = 0; i < client->spool.count; i++) {
+        client->spool.entries[(client->spool.head + i) % CLIENT_SPOOL_CAPACITY].sent = 0;
+    }
+
+    if (client->config.auto_reconnect && !client->should_shutdown) {
+        network_thread_schedule_reconnect(client);
+    }
+
+    //   ˸
+    client_notify_connection_lost(client, reason);
+
+    // ڵ 翬 Ȱȭ  翬 · ȯ
+    if (client->config.auto_reconnect && !client->should_shutdown) {
+        client_change_state(client, CLIENT_STATE_RECONNECTING, CLIENT_EVENT_RECONNECT_REQUESTED);
+    }
+}
\ No newline at end of file
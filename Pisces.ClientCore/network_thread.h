@@ -9,9 +9,7 @@
 // =============================================================================
 
 #define NETWORK_THREAD_TIMEOUT_MS   100     // Ʈũ ŸӾƿ
-#define RECONNECT_TIMEOUT_MS        1000    // 翬 üũ 
-#define COMMAND_QUEUE_TIMEOUT_MS    50      //  ť ŸӾƿ
-#define SOCKET_SELECT_TIMEOUT_MS    100     // select ŸӾƿ
+#define NETWORK_THREAD_RECV_BUDGET  64      //     ó ִ  ޽ 
 
 // =============================================================================
 // Ʈũ  Լ
@@ -24,6 +22,51 @@
  */
 DWORD WINAPI client_network_thread_proc(LPVOID param);
 
+// =============================================================================
+//   ó Լ (   client_reactor ȣ)
+// =============================================================================
+
+/**
+ *  Ʈũ ó غ (Ʈũ ʱȭ Ȯ)
+ * @param client Ŭ̾Ʈ νϽ
+ * @return   0,   -1
+ */
+int client_session_open(chat_client_t* client);
+
+/**
+ *       
+ * @param client Ŭ̾Ʈ νϽ
+ */
+void client_session_close(chat_client_t* client);
+
+/**
+ *     ó
+ * @param client Ŭ̾Ʈ νϽ
+ * @return ó  
+ */
+int client_session_process_commands(chat_client_t* client);
+
+/**
+ * ŵ  ޽ ó (NETWORK_THREAD_RECV_BUDGET)
+ * @param client Ŭ̾Ʈ νϽ
+ * @return   Ἥ  Ͱ    1, ƴϸ 0
+ */
+int client_session_process_input(chat_client_t* client);
+
+/**
+ * ƮƮ ŸӾƿ  翬 ð ó
+ * @param client Ŭ̾Ʈ νϽ
+ */
+void client_session_process_timers(chat_client_t* client);
+
+/**
+ * ⿡   ڵ ̺Ʈ ( ̸ õ   )
+ * @param client Ŭ̾Ʈ νϽ
+ * @param events  WSAPoll ̺Ʈ (, NULL )
+ * @return  ڵ,    INVALID_SOCKET
+ */
+SOCKET client_session_poll_handle(chat_client_t* client, short* events);
+
 // =============================================================================
 //   Լ (network_thread.c static )
 // =============================================================================
@@ -35,12 +78,16 @@ DWORD WINAPI client_network_thread_proc(LPVOID param);
 static int network_thread_initialize(chat_client_t* client);
 static void network_thread_cleanup(chat_client_t* client);
 static int network_thread_connect_to_server(chat_client_t* client, const char* host, uint16_t port);
+static int network_thread_continue_connect(chat_client_t* client);
 static int network_thread_send_auth_request(chat_client_t* client, const char* username);
 static int network_thread_handle_incoming_message(chat_client_t* client, message_t* message);
+static int network_thread_drain_commands(chat_client_t* client);
+static int network_thread_drain_socket(chat_client_t* client);
+static void network_thread_bind_socket_event(chat_client_t* client);
 static int network_thread_process_ui_command(chat_client_t* client, const ui_command_t* command);
 static int network_thread_send_chat_message(chat_client_t* client, const char* message);
 static int network_thread_request_user_list(chat_client_t* client);
-static int network_thread_send_heartbeat_ack(chat_client_t* client);
+static int network_thread_send_heartbeat_ack(chat_client_t* client, uint32_t echo_us);
 static int network_thread_check_reconnect(chat_client_t* client);
 static void network_thread_handle_connection_lost(chat_client_t* client, const char* reason);
 */
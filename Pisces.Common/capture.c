@@ -0,0 +1,170 @@
+#include "pch.h"
+#include "capture.h"
+#include "utils.h"
+#include <string.h>
+
+// =============================================================================
+//  
+// =============================================================================
+
+int g_capture_enabled = 0;
+
+static FILE* g_capture_file = NULL;
+static uint64_t g_capture_start_ticks = 0;
+static uint64_t g_capture_ticks_per_second = 0;
+static uint64_t g_capture_record_count = 0;
+
+// =============================================================================
+// ĸó 
+// =============================================================================
+
+int capture_open(const char* filename) {
+    if (utils_string_is_empty(filename)) {
+        return -1;
+    }
+
+    if (g_capture_file) {
+        LOG_WARNING("Capture already open, closing previous capture");
+        capture_close();
+    }
+
+    if (fopen_s(&g_capture_file, filename, "wb") != 0 || !g_capture_file) {
+        LOG_ERROR("Failed to create capture file: %s", filename);
+        g_capture_file = NULL;
+        return -1;
+    }
+
+    // Ӹ ý ȣ Ͼ ʵ ū  
+    setvbuf(g_capture_file, NULL, _IOFBF, CAPTURE_WRITE_BUFFER_SIZE);
+
+    capture_file_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.magic = CAPTURE_FILE_MAGIC;
+    header.version = CAPTURE_FILE_VERSION;
+    header.start_time_ms = utils_get_current_timestamp_ms();
+
+    if (fwrite(&header, sizeof(header), 1, g_capture_file) != 1) {
+        LOG_ERROR("Failed to write capture header: %s", filename);
+        fclose(g_capture_file);
+        g_capture_file = NULL;
+        return -1;
+    }
+
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    g_capture_ticks_per_second = (uint64_t)frequency.QuadPart;
+    g_capture_start_ticks = (uint64_t)counter.QuadPart;
+    g_capture_record_count = 0;
+
+    g_capture_enabled = 1;
+
+    LOG_INFO("Traffic capture enabled: %s", filename);
+    return 0;
+}
+
+void capture_close(void) {
+    g_capture_enabled = 0;
+
+    if (g_capture_file) {
+        fflush(g_capture_file);
+        fclose(g_capture_file);
+        g_capture_file = NULL;
+        LOG_INFO("Traffic capture closed (%llu records)", g_capture_record_count);
+    }
+}
+
+void capture_write_record(capture_record_kind_t kind, uint32_t conn_id, const message_t* msg) {
+    if (!g_capture_file) {
+        return;
+    }
+
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    uint64_t elapsed_ticks = (uint64_t)counter.QuadPart - g_capture_start_ticks;
+
+    uint32_t payload_size = msg ? ntohl(msg->header.payload_size) : 0;
+
+    capture_record_t record;
+    record.timestamp_us = elapsed_ticks / g_capture_ticks_per_second * 1000000 +
+        elapsed_ticks % g_capture_ticks_per_second * 1000000 / g_capture_ticks_per_second;
+    record.conn_id = conn_id;
+    record.kind = (uint16_t)kind;
+    record.reserved = 0;
+    record.length = msg ? (uint32_t)sizeof(message_header_t) + payload_size : 0;
+
+    //  ̷ε  ״(Ʈũ Ʈ ) 
+    int ok = fwrite(&record, sizeof(record), 1, g_capture_file) == 1;
+    if (ok && msg) {
+        ok = fwrite(&msg->header, sizeof(message_header_t), 1, g_capture_file) == 1;
+        if (ok && payload_size > 0 && msg->payload) {
+            ok = fwrite(msg->payload, payload_size, 1, g_capture_file) == 1;
+        }
+    }
+
+    if (!ok) {
+        LOG_ERROR("Failed to write capture record, capture disabled");
+        capture_close();
+        return;
+    }
+
+    g_capture_record_count++;
+}
+
+// =============================================================================
+// ĸó б
+// =============================================================================
+
+FILE* capture_reader_open(const char* filename, capture_file_header_t* header) {
+    if (utils_string_is_empty(filename) || !header) {
+        return NULL;
+    }
+
+    FILE* file = NULL;
+    if (fopen_s(&file, filename, "rb") != 0 || !file) {
+        LOG_ERROR("Cannot open capture file: %s", filename);
+        return NULL;
+    }
+
+    if (fread(header, sizeof(capture_file_header_t), 1, file) != 1 ||
+        header->magic != CAPTURE_FILE_MAGIC ||
+        header->version != CAPTURE_FILE_VERSION) {
+        LOG_ERROR("Not a valid capture file: %s", filename);
+        fclose(file);
+        return NULL;
+    }
+
+    return file;
+}
+
+int capture_read_record(FILE* file, capture_record_t* record, char* buffer, size_t buffer_size) {
+    if (!file || !record || !buffer) {
+        return -1;
+    }
+
+    size_t read_count = fread(record, sizeof(capture_record_t), 1, file);
+    if (read_count != 1) {
+        return feof(file) ? 0 : -1;
+    }
+
+    if (record->length > buffer_size) {
+        LOG_ERROR("Capture record too large: %u bytes", record->length);
+        return -1;
+    }
+
+    if (record->length > 0 && fread(buffer, record->length, 1, file) != 1) {
+        LOG_ERROR("Capture file is truncated");
+        return -1;
+    }
+
+    return 1;
+}
+
+const char* capture_record_kind_to_string(capture_record_kind_t kind) {
+    switch (kind) {
+    case CAPTURE_RECORD_OPEN:   return "OPEN";
+    case CAPTURE_RECORD_FRAME:  return "FRAME";
+    case CAPTURE_RECORD_CLOSE:  return "CLOSE";
+    default:                    return "UNKNOWN";
+    }
+}
@@ -0,0 +1,117 @@
+// capture.h
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include "common_headers.h"
+#include "message.h"
+#include <stdio.h>
+#include <stdint.h>
+
+// =============================================================================
+// ĸó  
+// =============================================================================
+
+#define CAPTURE_FILE_MAGIC          0x4C505250  // "PRPL"
+#define CAPTURE_FILE_VERSION        1
+#define CAPTURE_WRITE_BUFFER_SIZE   65536       //    ũ
+
+// ĸó ڵ 
+typedef enum {
+    CAPTURE_RECORD_OPEN = 1,        //  
+    CAPTURE_RECORD_FRAME = 2,       //   ( + ̷ε )
+    CAPTURE_RECORD_CLOSE = 3        //  
+} capture_record_kind_t;
+
+// =============================================================================
+// ĸó   (ũ , Ʋ )
+// =============================================================================
+
+#pragma pack(push, 1)
+
+//   (16Ʈ)
+typedef struct {
+    uint32_t magic;                 // CAPTURE_FILE_MAGIC
+    uint16_t version;               // CAPTURE_FILE_VERSION
+    uint16_t reserved;
+    uint64_t start_time_ms;         // ĸó  ð (epoch и)
+} capture_file_header_t;
+
+// ڵ  (20Ʈ, ڿ length Ʈ  Ͱ ̾)
+typedef struct {
+    uint64_t timestamp_us;          // ĸó    ð (ũ)
+    uint32_t conn_id;               // (Ŭ̾Ʈ) ID
+    uint16_t kind;                  // capture_record_kind_t
+    uint16_t reserved;
+    uint32_t length;                //    (OPEN/CLOSE 0)
+} capture_record_t;
+
+#pragma pack(pop)
+
+// =============================================================================
+// ĸó  ũ
+// =============================================================================
+
+// ĸó Ȱȭ  ( )
+extern int g_capture_enabled;
+
+#define CAPTURE_OPEN(conn_id) \
+    do { if (g_capture_enabled) capture_write_record(CAPTURE_RECORD_OPEN, conn_id, NULL); } while(0)
+#define CAPTURE_FRAME(conn_id, msg) \
+    do { if (g_capture_enabled) capture_write_record(CAPTURE_RECORD_FRAME, conn_id, msg); } while(0)
+#define CAPTURE_CLOSE(conn_id) \
+    do { if (g_capture_enabled) capture_write_record(CAPTURE_RECORD_CLOSE, conn_id, NULL); } while(0)
+
+// =============================================================================
+// ĸó  Լ ()
+// =============================================================================
+
+/**
+ * ĸó  ϰ   (  )
+ * @param filename ĸó  
+ * @return   0,   -1
+ */
+int capture_open(const char* filename);
+
+/**
+ * ĸó   (۸   ݱ)
+ */
+void capture_close(void);
+
+/**
+ * ڵ  (CAPTURE_* ũθ  ȣ)
+ * @param kind ڵ 
+ * @param conn_id  ID
+ * @param msg   (FRAME ƴϸ NULL)
+ */
+void capture_write_record(capture_record_kind_t kind, uint32_t conn_id, const message_t* msg);
+
+// =============================================================================
+// ĸó б Լ (÷ )
+// =============================================================================
+
+/**
+ * ĸó     
+ * @param filename ĸó  
+ * @param header о  ()
+ * @return    ڵ,   NULL
+ */
+FILE* capture_reader_open(const char* filename, capture_file_header_t* header);
+
+/**
+ *  ڵ б
+ * @param file ĸó  ڵ
+ * @param record ڵ  ()
+ * @param buffer   
+ * @param buffer_size  ũ (ּ MAX_MESSAGE_SIZE)
+ * @return о 1,  ̸ 0,   -1
+ */
+int capture_read_record(FILE* file, capture_record_t* record, char* buffer, size_t buffer_size);
+
+/**
+ * ڵ  ڿ ȯ
+ * @param kind ڵ 
+ * @return  ڿ
+ */
+const char* capture_record_kind_to_string(capture_record_kind_t kind);
+
+#endif // CAPTURE_H
@@ -0,0 +1,89 @@
+#include "pch.h"
+#define LOG_MODULE LOG_MODULE_NETWORK
+#include "compress.h"
+#include "utils.h"
+#include <stdlib.h>
+
+#pragma comment(lib, "cabinet.lib")
+
+// =============================================================================
+// ؽƮ /
+// =============================================================================
+
+compress_context_t* compress_context_create(void) {
+    compress_context_t* context = (compress_context_t*)calloc(1, sizeof(compress_context_t));
+    if (!context) {
+        LOG_ERROR("Failed to allocate compression context");
+        return NULL;
+    }
+
+    return context;
+}
+
+void compress_context_destroy(compress_context_t* context) {
+    if (!context) {
+        return;
+    }
+
+    if (context->compressor) {
+        CloseCompressor(context->compressor);
+    }
+    if (context->decompressor) {
+        CloseDecompressor(context->decompressor);
+    }
+
+    free(context);
+}
+
+// =============================================================================
+// /
+// =============================================================================
+
+int compress_data(compress_context_t* context, const void* input, size_t input_size,
+    void* output, size_t output_capacity) {
+    if (!context || !input || !output || input_size == 0) {
+        return -1;
+    }
+
+    if (!context->compressor &&
+        !CreateCompressor(COMPRESS_ALGORITHM, NULL, &context->compressor)) {
+        LOG_ERROR("Failed to create compressor (error %lu)", GetLastError());
+        context->compressor = NULL;
+        return -1;
+    }
+
+    //  ۰ ڶ ERROR_INSUFFICIENT_BUFFER ϹǷ ̵   ⼭ ɷ
+    SIZE_T compressed_size = 0;
+    if (!Compress(context->compressor, input, input_size, output, output_capacity, &compressed_size)) {
+        return -1;
+    }
+
+    context->bytes_in += input_size;
+    context->bytes_out += compressed_size;
+    return (int)compressed_size;
+}
+
+int compress_decompress_data(compress_context_t* context, const void* input, size_t input_size,
+    void* output, size_t output_size) {
+    if (!context || !input || !output || input_size == 0) {
+        return -1;
+    }
+
+    if (!context->decompressor &&
+        !CreateDecompressor(COMPRESS_ALGORITHM, NULL, &context->decompressor)) {
+        LOG_ERROR("Failed to create decompressor (error %lu)", GetLastError());
+        context->decompressor = NULL;
+        return -1;
+    }
+
+    SIZE_T decompressed_size = 0;
+    if (!Decompress(context->decompressor, input, input_size, output, output_size, &decompressed_size) ||
+        decompressed_size != output_size) {
+        LOG_ERROR("Failed to decompress frame (error %lu)", GetLastError());
+        return -1;
+    }
+
+    context->bytes_in += decompressed_size;
+    context->bytes_out += input_size;
+    return 0;
+}
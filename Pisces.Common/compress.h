@@ -0,0 +1,67 @@
+// compress.h
+#ifndef COMPRESS_H
+#define COMPRESS_H
+
+#include "common_headers.h"
+#include <compressapi.h>
+#include <stdint.h>
+
+// =============================================================================
+//   
+// =============================================================================
+
+#define COMPRESS_ALGORITHM          COMPRESS_ALGORITHM_XPRESS_HUFF  // ӵ  (  API)
+
+// =============================================================================
+//  ؽƮ
+// =============================================================================
+
+// / ڵ  ( Ǵ  ϳ,  忡 )
+typedef struct compress_context_s {
+    COMPRESSOR_HANDLE compressor;       //  ڵ (ó   )
+    DECOMPRESSOR_HANDLE decompressor;   //  ڵ (ó   )
+    uint64_t bytes_in;                  //    Ʈ
+    uint64_t bytes_out;                 //    Ʈ
+} compress_context_t;
+
+// =============================================================================
+//  Լ
+// =============================================================================
+
+/**
+ *  ؽƮ 
+ * @return ؽƮ,   NULL
+ */
+compress_context_t* compress_context_create(void);
+
+/**
+ *  ؽƮ 
+ * @param context ؽƮ (NULL )
+ */
+void compress_context_destroy(compress_context_t* context);
+
+/**
+ *  
+ * @param context ؽƮ
+ * @param input  
+ * @param input_size  ũ
+ * @param output  
+ * @param output_capacity   ũ ( ۰ ָ ̵   )
+ * @return  ũ, ϰų  ۿ   -1
+ */
+int compress_data(compress_context_t* context, const void* input, size_t input_size,
+    void* output, size_t output_capacity);
+
+/**
+ *  
+ * @param context ؽƮ
+ * @param input  
+ * @param input_size  ũ
+ * @param output  
+ * @param output_size  ũ (Ȯ ̸ŭ Ǿ )
+ * @return   0,   -1
+ */
+int compress_decompress_data(compress_context_t* context, const void* input, size_t input_size,
+    void* output, size_t output_size);
+
+#endif // COMPRESS_H
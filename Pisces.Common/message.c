@@ -1,4 +1,5 @@
 #include "pch.h"
+#define LOG_MODULE LOG_MODULE_MESSAGE
 #include "message.h"
 #include <stdlib.h>
 #include <string.h>
@@ -90,6 +91,114 @@ int message_serialize(const message_t* msg, char* buffer, size_t buffer_size) {
     return (int)total_size;
 }
 
+int message_serialize_compact(const message_t* msg, char* buffer, size_t buffer_size) {
+    if (!msg || !buffer) {
+        return -1;
+    }
+
+    uint32_t payload_size = ntohl(msg->header.payload_size);
+    if (buffer_size < COMPACT_HEADER_MAX_SIZE + payload_size) {
+        return -1;  // ۰ ʹ 
+    }
+
+    int header_size = message_encode_compact_header(ntohs(msg->header.type), payload_size, (uint8_t*)buffer);
+
+    if (payload_size > 0 && msg->payload) {
+        memcpy(buffer + header_size, msg->payload, payload_size);
+    }
+
+    return header_size + (int)payload_size;
+}
+
+int message_encode_compact_header(uint16_t type, uint32_t payload_size, uint8_t* buffer) {
+    uint8_t flags = (uint8_t)(message_get_priority(type) << FRAME_FLAG_PRIORITY_SHIFT);
+    if (type == MSG_COMPRESSED) {
+        flags |= FRAME_FLAG_COMPRESSED;
+    }
+    else if (type == MSG_BATCH) {
+        flags |= FRAME_FLAG_BATCHED;
+    }
+
+    buffer[0] = COMPACT_TYPE_CODE(type);
+    buffer[1] = flags;
+
+    // 7Ʈ  (MAX_MESSAGE_SIZE ̹Ƿ ִ 2Ʈ)
+    if (payload_size < 0x80) {
+        buffer[2] = (uint8_t)payload_size;
+        return 3;
+    }
+
+    buffer[2] = (uint8_t)(0x80 | (payload_size & 0x7F));
+    buffer[3] = (uint8_t)(payload_size >> 7);
+    return 4;
+}
+
+int message_decode_compact_header(const uint8_t* buffer, int length, uint16_t* type, uint32_t* payload_size) {
+    if (length < COMPACT_HEADER_MIN_SIZE) {
+        return 0;
+    }
+
+    uint32_t size = buffer[2];
+    int header_size = 3;
+    if (size & 0x80) {
+        if (length < COMPACT_HEADER_MAX_SIZE) {
+            return 0;
+        }
+        size = (size & 0x7F) | ((uint32_t)buffer[3] << 7);
+        header_size = 4;
+    }
+
+    // Ϲ   Ÿ ,  ÷, ũ 񱳻
+    uint16_t decoded_type = COMPACT_TYPE_FROM_CODE(buffer[0]);
+    if (decoded_type < MSG_SYSTEM_BASE || decoded_type > MSG_ERROR_INVALID_USERNAME ||
+        (buffer[1] & FRAME_FLAG_RESERVED_MASK) ||
+        size > MAX_MESSAGE_SIZE - sizeof(message_header_t)) {
+        return -1;
+    }
+
+    *type = decoded_type;
+    *payload_size = size;
+    return header_size;
+}
+
+int message_batch_next(const message_t* batch, uint32_t* offset, message_t* item) {
+    if (!batch || !offset || !item) {
+        return -1;
+    }
+
+    uint32_t payload_size = ntohl(batch->header.payload_size);
+    if (*offset >= payload_size) {
+        return 0;
+    }
+
+    if (payload_size - *offset < sizeof(batch_item_header_t)) {
+        return -1;
+    }
+
+    batch_item_header_t item_header;
+    memcpy(&item_header, batch->payload + *offset, sizeof(item_header));
+
+    uint16_t type = ntohs(item_header.type);
+    uint16_t item_size = ntohs(item_header.payload_size);
+    uint32_t item_offset = *offset + (uint32_t)sizeof(batch_item_header_t);
+
+    //  ȿ ̳    
+    if (type < MSG_SYSTEM_BASE || type > MSG_ERROR_INVALID_USERNAME ||
+        type == MSG_BATCH || type == MSG_COMPRESSED ||
+        item_size > payload_size - item_offset) {
+        return -1;
+    }
+
+    item->header.magic = htonl(PROTOCOL_MAGIC);
+    item->header.version = htons(PROTOCOL_VERSION);
+    item->header.type = item_header.type;
+    item->header.payload_size = htonl(item_size);
+    item->payload = item_size > 0 ? batch->payload + item_offset : NULL;
+
+    *offset = item_offset + item_size;
+    return 1;
+}
+
 message_t* message_deserialize(const char* buffer, size_t buffer_size) {
     if (!buffer || buffer_size < sizeof(message_header_t)) {
         return NULL;
@@ -184,7 +293,7 @@ int message_validate_header(const message_header_t* header) {
 //  Լ (Ư Ÿ ޽ )
 // =============================================================================
 
-message_t* message_create_connect_request(const char* username) {
+message_t* message_create_connect_request(const char* username, uint32_t capabilities) {
     if (!username || strlen(username) >= MAX_USERNAME_LENGTH) {
         return NULL;
     }
@@ -192,14 +301,17 @@ message_t* message_create_connect_request(const char* username) {
     connect_request_payload_t payload = { 0 };
     strncpy_s(payload.username, sizeof(payload.username), username, _TRUNCATE);
     payload.client_version = htonl(PROTOCOL_VERSION);
+    payload.capabilities = htonl(capabilities);
 
     return message_create(MSG_CONNECT_REQUEST, &payload, sizeof(payload));
 }
 
-message_t* message_create_connect_response(response_code_t result, const char* message, uint32_t user_id) {
+message_t* message_create_connect_response(response_code_t result, const char* message, uint32_t user_id,
+    uint32_t capabilities) {
     connect_response_payload_t payload = { 0 };
     payload.result = htonl((uint32_t)result);
     payload.user_id = htonl(user_id);
+    payload.capabilities = htonl(capabilities);
 
     if (message) {
         strncpy_s(payload.message, sizeof(payload.message), message, _TRUNCATE);
@@ -208,6 +320,21 @@ message_t* message_create_connect_response(response_code_t result, const char* m
     return message_create(MSG_CONNECT_RESPONSE, &payload, sizeof(payload));
 }
 
+message_t* message_create_session_resume(const char* username, const char* token, uint32_t last_sequence,
+    uint32_t capabilities) {
+    if (!username || !token || strlen(username) >= MAX_USERNAME_LENGTH || strlen(token) > SESSION_TOKEN_LENGTH) {
+        return NULL;
+    }
+
+    session_resume_payload_t payload = { 0 };
+    strncpy_s(payload.username, sizeof(payload.username), username, _TRUNCATE);
+    strncpy_s(payload.token, sizeof(payload.token), token, _TRUNCATE);
+    payload.last_sequence = htonl(last_sequence);
+    payload.capabilities = htonl(capabilities);
+
+    return message_create(MSG_SESSION_RESUME, &payload, sizeof(payload));
+}
+
 message_t* message_create_chat(uint32_t sender_id, const char* sender_name, const char* content) {
     if (!sender_name || !content) {
         return NULL;
@@ -226,6 +353,48 @@ message_t* message_create_chat(uint32_t sender_id, const char* sender_name, cons
     return message_create(MSG_CHAT_BROADCAST, &payload, sizeof(payload));
 }
 
+int message_append_chat_record(char* payload, size_t capacity, size_t used, uint32_t message_id, const char* text) {
+    if (!payload || !text) {
+        return -1;
+    }
+
+    size_t length = strlen(text);
+    if (length > UINT16_MAX || used + CHAT_RECORD_HEADER_SIZE + length > capacity) {
+        return -1;
+    }
+
+    uint32_t net_id = htonl(message_id);
+    uint16_t net_length = htons((uint16_t)length);
+    memcpy(payload + used, &net_id, sizeof(net_id));
+    memcpy(payload + used + sizeof(net_id), &net_length, sizeof(net_length));
+    memcpy(payload + used + CHAT_RECORD_HEADER_SIZE, text, length);
+
+    return (int)(used + CHAT_RECORD_HEADER_SIZE + length);
+}
+
+int message_read_chat_record(const char* payload, uint32_t payload_size, uint32_t* offset,
+    uint32_t* message_id, const char** text, uint16_t* length) {
+    if (!payload || !offset || *offset + CHAT_RECORD_HEADER_SIZE > payload_size) {
+        return -1;
+    }
+
+    uint32_t net_id;
+    uint16_t net_length;
+    memcpy(&net_id, payload + *offset, sizeof(net_id));
+    memcpy(&net_length, payload + *offset + sizeof(net_id), sizeof(net_length));
+
+    uint16_t record_length = ntohs(net_length);
+    if (*offset + CHAT_RECORD_HEADER_SIZE + record_length > payload_size) {
+        return -1;
+    }
+
+    *message_id = ntohl(net_id);
+    *text = payload + *offset + CHAT_RECORD_HEADER_SIZE;
+    *length = record_length;
+    *offset += CHAT_RECORD_HEADER_SIZE + record_length;
+    return 0;
+}
+
 message_t* message_create_error(response_code_t error_code, const char* error_message) {
     error_payload_t payload = { 0 };
     payload.error_code = htonl((uint32_t)error_code);
@@ -239,6 +408,25 @@ message_t* message_create_error(response_code_t error_code, const char* error_me
     return message_create(MSG_ERROR_GENERIC, &payload, sizeof(payload));
 }
 
+message_t* message_create_server_full(uint32_t retry_after_sec) {
+    error_payload_t payload = { 0 };
+    payload.error_code = htonl((uint32_t)RESPONSE_SERVER_FULL);
+    payload.error_context = htonl(retry_after_sec);
+
+    sprintf_s(payload.error_message, sizeof(payload.error_message),
+        "Server is full. Please try again in %u seconds.", retry_after_sec);
+
+    return message_create(MSG_ERROR_SERVER_FULL, &payload, sizeof(payload));
+}
+
+message_t* message_create_heartbeat(message_type_t type, uint32_t timestamp_us, uint32_t echo_us) {
+    heartbeat_payload_t payload;
+    payload.timestamp_us = htonl(timestamp_us);
+    payload.echo_us = htonl(echo_us);
+
+    return message_create(type, &payload, sizeof(payload));
+}
+
 // =============================================================================
 //   Լ
 // =============================================================================
@@ -251,6 +439,10 @@ const char* message_type_to_string(message_type_t type) {
     case MSG_DISCONNECT:         return "DISCONNECT";
     case MSG_HEARTBEAT:          return "HEARTBEAT";
     case MSG_HEARTBEAT_ACK:      return "HEARTBEAT_ACK";
+    case MSG_SESSION_TOKEN:      return "SESSION_TOKEN";
+    case MSG_SESSION_RESUME:     return "SESSION_RESUME";
+    case MSG_COMPRESSED:         return "COMPRESSED";
+    case MSG_BATCH:              return "BATCH";
 
         //  ޽
     case MSG_AUTH_REQUEST:       return "AUTH_REQUEST";
@@ -261,12 +453,14 @@ const char* message_type_to_string(message_type_t type) {
     case MSG_CHAT_SEND:          return "CHAT_SEND";
     case MSG_CHAT_BROADCAST:     return "CHAT_BROADCAST";
     case MSG_CHAT_PRIVATE:       return "CHAT_PRIVATE";
+    case MSG_CHAT_SUBMIT:        return "CHAT_SUBMIT";
 
         //  
     case MSG_USER_LIST_REQUEST:  return "USER_LIST_REQUEST";
     case MSG_USER_LIST_RESPONSE: return "USER_LIST_RESPONSE";
     case MSG_USER_JOINED:        return "USER_JOINED";
     case MSG_USER_LEFT:          return "USER_LEFT";
+    case MSG_USER_PRESENCE:      return "USER_PRESENCE";
 
         //  ޽
     case MSG_ERROR_GENERIC:      return "ERROR_GENERIC";
@@ -308,6 +502,20 @@ void message_print_debug(const message_t* msg) {
     }
 }
 
+message_priority_t message_get_priority(uint16_t type) {
+    if (IS_ERROR_MSG(type)) {
+        return PRIORITY_CRITICAL;
+    }
+    if (IS_AUTH_MSG(type) || type == MSG_CONNECT_REQUEST || type == MSG_CONNECT_RESPONSE ||
+        type == MSG_SESSION_RESUME || type == MSG_SESSION_TOKEN) {
+        return PRIORITY_HIGH;
+    }
+    if (IS_CHAT_MSG(type)) {
+        return PRIORITY_LOW;
+    }
+    return PRIORITY_NORMAL;
+}
+
 size_t message_get_total_size(const message_t* msg) {
     if (!msg) return 0;
     return sizeof(message_header_t) + ntohl(msg->header.payload_size);
@@ -2,6 +2,7 @@
 #define MESSAGE_H
 
 #include "protocol.h"
+#include <stddef.h>
 #include <stdint.h>
 #include <time.h>
 
@@ -31,15 +32,23 @@ typedef struct {
 typedef struct {
     char username[MAX_USERNAME_LENGTH];
     uint32_t client_version;
+    uint32_t capabilities;    // Ŭ̾Ʈ ϴ   (PROTOCOL_CAP_*)
 } connect_request_payload_t;
 
+// capabilities   Ŭ̾Ʈ  û ũ (   )
+#define CONNECT_REQUEST_MIN_SIZE    offsetof(connect_request_payload_t, capabilities)
+
 //   ̷ε
 typedef struct {
     response_code_t result;
     char message[256];        // / ޽
     uint32_t user_id;         //   Ҵ  ID
+    uint32_t capabilities;    //   ῡ    (PROTOCOL_CAP_*)
 } connect_response_payload_t;
 
+// capabilities      ũ
+#define CONNECT_RESPONSE_MIN_SIZE   offsetof(connect_response_payload_t, capabilities)
+
 //  û ̷ε
 typedef struct {
     char username[MAX_USERNAME_LENGTH];
@@ -57,16 +66,50 @@ typedef struct {
 typedef struct {
     uint32_t sender_id;
     char sender_name[MAX_USERNAME_LENGTH];
-    char message[MAX_MESSAGE_SIZE - sizeof(message_header_t) - 64]; //   Ȱ
+    char message[MAX_MESSAGE_SIZE - sizeof(message_header_t) - 72]; //   Ȱ
     time_t timestamp;
+    uint32_t sequence;        //  ű ä  (簳  ģ ޽ Ȯο)
+    uint32_t message_id;      // ߽ڰ  ޽ ID (߽  Ȯο,  0)
 } chat_message_payload_t;
 
+// ä  ̷ε (MSG_CHAT_SUBMIT) Ʒ ڵ尡 ϳ ̻ ̾ 
+// [޽ ID 4Ʈ][  2Ʈ][ (null )] -  Ʈũ Ʈ 
+
+// ƮƮ ̷ε (  timestamp_us ACK echo_us ״ , 0 "")
+typedef struct {
+    uint32_t timestamp_us;    //    ð (network_rtt_timestamp)
+    uint32_t echo_us;         //  ƮƮ  ð
+} heartbeat_payload_t;
+
+//  ū ̷ε (/簳   ߱)
+typedef struct {
+    char token[SESSION_TOKEN_LENGTH + 1];
+    uint32_t last_sequence;   // ߱   ä 
+} session_token_payload_t;
+
+//  簳 û ̷ε
+typedef struct {
+    char username[MAX_USERNAME_LENGTH];
+    char token[SESSION_TOKEN_LENGTH + 1];
+    uint32_t last_sequence;   // Ŭ̾Ʈ   ä 
+    uint32_t capabilities;    // Ŭ̾Ʈ ϴ   (PROTOCOL_CAP_*)
+} session_resume_payload_t;
+
+// capabilities   Ŭ̾Ʈ  簳 û ũ
+#define SESSION_RESUME_MIN_SIZE     offsetof(session_resume_payload_t, capabilities)
+
 //    ̷ε
 typedef struct {
     uint32_t user_count;
     char users[][MAX_USERNAME_LENGTH];  //   迭
 } user_list_payload_t;
 
+//   ׸  (MSG_BATCH ̷ε [׸ ][̷ε] )
+typedef struct {
+    uint16_t type;            // ޽ Ÿ
+    uint16_t payload_size;    // ׸ ̷ε ũ
+} batch_item_header_t;
+
 //  ޽ ̷ε
 typedef struct {
     response_code_t error_code;
@@ -121,6 +164,43 @@ int message_serialize(const message_t* msg, char* buffer, size_t buffer_size);
  */
 message_t* message_deserialize(const char* buffer, size_t buffer_size);
 
+/**
+ * ޽    ȭ
+ * @param msg ȭ ޽
+ * @param buffer  
+ * @param buffer_size  ũ
+ * @return   Ʈ  (  -1)
+ */
+int message_serialize_compact(const message_t* msg, char* buffer, size_t buffer_size);
+
+/**
+ *   ڵ
+ * @param type ޽ Ÿ
+ * @param payload_size ̷ε ũ
+ * @param buffer   (COMPACT_HEADER_MAX_SIZE ̻)
+ * @return  
+ */
+int message_encode_compact_header(uint16_t type, uint32_t payload_size, uint8_t* buffer);
+
+/**
+ *   ڵ  
+ * @param buffer Է Ʈ
+ * @param length   ִ Ʈ 
+ * @param type ޽ Ÿ ()
+ * @param payload_size ̷ε ũ ()
+ * @return  , Ʈ  ʿϸ 0, ߸  -1
+ */
+int message_decode_compact_header(const uint8_t* buffer, int length, uint16_t* type, uint32_t* payload_size);
+
+/**
+ *    ׸ б (   ̷ε带 Ŵ)
+ * @param batch MSG_BATCH ޽
+ * @param offset ̷ε  б ġ (ó 0, ȣ  )
+ * @param item ׸ ޽ (, payload batch ̷ε带 ŰǷ ϸ  )
+ * @return ׸ о 1, ̸ 0, ߸ ׸̸ -1
+ */
+int message_batch_next(const message_t* batch, uint32_t* offset, message_t* item);
+
 /**
  * ޽  ȭ (̷ε ũ Ȯο)
  * @param buffer Է Ʈ 迭
@@ -154,18 +234,32 @@ int message_validate_header(const message_header_t* header);
 /**
  *  û ޽ 
  * @param username ڸ
+ * @param capabilities ϴ   (PROTOCOL_CAP_*)
  * @return  ޽
  */
-message_t* message_create_connect_request(const char* username);
+message_t* message_create_connect_request(const char* username, uint32_t capabilities);
 
 /**
  *   ޽ 
  * @param result  ڵ
  * @param message ޽ 
  * @param user_id  ID
+ * @param capabilities  ῡ    (PROTOCOL_CAP_*)
+ * @return  ޽
+ */
+message_t* message_create_connect_response(response_code_t result, const char* message, uint32_t user_id,
+    uint32_t capabilities);
+
+/**
+ *  簳 û ޽ 
+ * @param username ڸ
+ * @param token  ߱ 簳 ū
+ * @param last_sequence   ä 
+ * @param capabilities ϴ   (PROTOCOL_CAP_*)
  * @return  ޽
  */
-message_t* message_create_connect_response(response_code_t result, const char* message, uint32_t user_id);
+message_t* message_create_session_resume(const char* username, const char* token, uint32_t last_sequence,
+    uint32_t capabilities);
 
 /**
  * ä ޽ 
@@ -176,6 +270,30 @@ message_t* message_create_connect_response(response_code_t result, const char* m
  */
 message_t* message_create_chat(uint32_t sender_id, const char* sender_name, const char* content);
 
+/**
+ * ä  ̷ε忡 ڵ ߰ (MSG_CHAT_SUBMIT)
+ * @param payload ̷ε 
+ * @param capacity  ũ
+ * @param used ̹  Ʈ 
+ * @param message_id  ȿ ϴ ޽ ID
+ * @param text ä 
+ * @return ߰   Ʈ ,  ϸ -1
+ */
+int message_append_chat_record(char* payload, size_t capacity, size_t used, uint32_t message_id, const char* text);
+
+/**
+ * ä  ̷ε忡 ڵ ϳ 
+ * @param payload ̷ε
+ * @param payload_size ̷ε ũ
+ * @param offset  ġ (   ڵ ġ ̵)
+ * @param message_id : ޽ ID
+ * @param text :   ġ (null  )
+ * @param length :  
+ * @return   0,  ڵ尡 ų  ߸Ǿ -1
+ */
+int message_read_chat_record(const char* payload, uint32_t payload_size, uint32_t* offset,
+    uint32_t* message_id, const char** text, uint16_t* length);
+
 /**
  *  ޽ 
  * @param error_code  ڵ
@@ -184,6 +302,22 @@ message_t* message_create_chat(uint32_t sender_id, const char* sender_name, cons
  */
 message_t* message_create_error(response_code_t error_code, const char* error_message);
 
+/**
+ *  ȭ ޽  (MSG_ERROR_SERVER_FULL, error_context õ  ð)
+ * @param retry_after_sec Ŭ̾Ʈ ٽ ϱ  ٸ ð ()
+ * @return  ޽
+ */
+message_t* message_create_server_full(uint32_t retry_after_sec);
+
+/**
+ * ƮƮ Ǵ ƮƮ ACK 
+ * @param type MSG_HEARTBEAT Ǵ MSG_HEARTBEAT_ACK
+ * @param timestamp_us   ð (0̸ պ  û )
+ * @param echo_us 뿡  ð (0̸ )
+ * @return  ޽
+ */
+message_t* message_create_heartbeat(message_type_t type, uint32_t timestamp_us, uint32_t echo_us);
+
 // =============================================================================
 //   Լ
 // =============================================================================
@@ -201,6 +335,13 @@ const char* message_type_to_string(message_type_t type);
  */
 void message_print_debug(const message_t* msg);
 
+/**
+ * ޽ Ÿ  켱
+ * @param type ޽ Ÿ
+ * @return 켱
+ */
+message_priority_t message_get_priority(uint16_t type);
+
 /**
  * ޽ ũ 
  * @param msg ޽
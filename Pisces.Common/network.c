@@ -1,4 +1,5 @@
 #include "pch.h"
+#define LOG_MODULE LOG_MODULE_NETWORK
 #include "network.h"
 #include "message.h"
 #include "utils.h"
@@ -12,6 +13,24 @@
 
 static int g_network_initialized = 0;
 
+// =============================================================================
+//   Լ 
+// =============================================================================
+
+static network_socket_t* network_socket_wrap_handle(SOCKET handle, const struct sockaddr* addr, int addr_len);
+static void network_format_address(const struct sockaddr* addr, char* ip_buffer, size_t buffer_size, uint16_t* port);
+static network_result_t network_result_from_winsock(int error);
+static network_result_t network_connector_start_attempt(network_connector_t* connector, int index);
+static void network_connector_close_attempt(network_connector_t* connector, int index);
+static void network_send_queue_consume(network_send_queue_t* queue, uint32_t bytes,
+    network_frame_sent_t on_sent, void* context);
+static void network_send_queue_complete(network_socket_t* sock, network_send_queue_t* queue, uint32_t bytes,
+    network_frame_sent_t on_sent, void* context);
+static network_result_t network_flush_error(network_socket_t* sock, int error);
+static message_t* network_decompress_message(network_socket_t* sock, const message_t* msg);
+static message_t* network_recv_full_message(network_socket_t* sock);
+static message_t* network_recv_compact_message(network_socket_t* sock);
+
 // =============================================================================
 // Ʈũ ʱȭ/
 // =============================================================================
@@ -90,7 +109,7 @@ network_socket_t* network_socket_create(socket_type_t type) {
     sock->bytes_received = 0;
     sock->messages_sent = 0;
     sock->messages_received = 0;
-    sock->created_time = time(NULL);
+    sock->created_time = utils_clock_now_ms();
     sock->last_activity = sock->created_time;
 
     LOG_DEBUG("Created socket (handle: %d, type: %d)", (int)sock->handle, type);
@@ -105,6 +124,8 @@ void network_socket_destroy(network_socket_t* sock) {
         sock->handle = INVALID_SOCKET;
     }
 
+    compress_context_destroy(sock->codec);
+
     LOG_DEBUG("Destroyed socket");
     free(sock);
 }
@@ -142,6 +163,54 @@ network_result_t network_socket_set_reuse_addr(network_socket_t* sock, int enabl
     return NETWORK_SUCCESS;
 }
 
+network_result_t network_socket_set_nodelay(network_socket_t* sock, int enable) {
+    if (!sock || sock->handle == INVALID_SOCKET) {
+        return NETWORK_INVALID_SOCKET;
+    }
+
+    int optval = enable ? 1 : 0;
+    if (setsockopt(sock->handle, IPPROTO_TCP, TCP_NODELAY,
+        (char*)&optval, sizeof(optval)) == SOCKET_ERROR) {
+        LOG_ERROR("Failed to set TCP_NODELAY: %s",
+            utils_winsock_error_to_string(WSAGetLastError()));
+        return NETWORK_ERROR;
+    }
+
+    LOG_DEBUG("Set TCP_NODELAY to %s", enable ? "enabled" : "disabled");
+    return NETWORK_SUCCESS;
+}
+
+network_result_t network_socket_set_send_buffer(network_socket_t* sock, int size) {
+    if (!sock || sock->handle == INVALID_SOCKET) {
+        return NETWORK_INVALID_SOCKET;
+    }
+
+    if (setsockopt(sock->handle, SOL_SOCKET, SO_SNDBUF,
+        (char*)&size, sizeof(size)) == SOCKET_ERROR) {
+        LOG_ERROR("Failed to set SO_SNDBUF: %s",
+            utils_winsock_error_to_string(WSAGetLastError()));
+        return NETWORK_ERROR;
+    }
+
+    LOG_DEBUG("Set SO_SNDBUF to %d", size);
+    return NETWORK_SUCCESS;
+}
+
+uint32_t network_socket_get_mss(network_socket_t* sock) {
+    if (!sock || sock->handle == INVALID_SOCKET) {
+        return NETWORK_DEFAULT_MSS;
+    }
+
+    //   TCP_MAXSEG ȸ  Ƿ ⺻ 
+    int mss = 0;
+    int optlen = sizeof(mss);
+    if (getsockopt(sock->handle, IPPROTO_TCP, TCP_MAXSEG, (char*)&mss, &optlen) == SOCKET_ERROR || mss <= 0) {
+        return NETWORK_DEFAULT_MSS;
+    }
+
+    return (uint32_t)mss;
+}
+
 network_result_t network_socket_set_timeout(network_socket_t* sock, int timeout_ms) {
     if (!sock || sock->handle == INVALID_SOCKET) {
         return NETWORK_INVALID_SOCKET;
@@ -221,8 +290,14 @@ network_result_t network_socket_listen(network_socket_t* sock, int backlog) {
     if (backlog <= 0) {
         backlog = MAX_PENDING_CONNECTIONS;
     }
+    if (backlog > NETWORK_LISTEN_BACKLOG_MAX) {
+        backlog = NETWORK_LISTEN_BACKLOG_MAX;
+    }
 
-    if (listen(sock->handle, backlog) == SOCKET_ERROR) {
+    // Winsock Ϲ  SOMAXCONN ѵ( 200) ڸǷ ū ⿭ Ʈ û
+    int requested = backlog > NETWORK_LISTEN_BACKLOG_HINT ? SOMAXCONN_HINT(backlog) : backlog;
+
+    if (listen(sock->handle, requested) == SOCKET_ERROR) {
         LOG_ERROR("Failed to listen on socket: %s",
             utils_winsock_error_to_string(WSAGetLastError()));
         return NETWORK_ERROR;
@@ -239,7 +314,7 @@ network_socket_t* network_socket_accept(network_socket_t* server_sock) {
         return NULL;
     }
 
-    struct sockaddr_in client_addr;
+    struct sockaddr_storage client_addr;
     int client_addr_len = sizeof(client_addr);
 
     SOCKET client_handle = accept(server_sock->handle,
@@ -255,26 +330,14 @@ network_socket_t* network_socket_accept(network_socket_t* server_sock) {
     }
 
     //  Ŭ̾Ʈ  
-    network_socket_t* client_sock = (network_socket_t*)calloc(1, sizeof(network_socket_t));
+    network_socket_t* client_sock = network_socket_wrap_handle(client_handle,
+        (struct sockaddr*)&client_addr, client_addr_len);
     if (!client_sock) {
-        LOG_ERROR("Failed to allocate memory for client socket");
         closesocket(client_handle);
         return NULL;
     }
 
-    // Ŭ̾Ʈ  ʱȭ
-    client_sock->handle = client_handle;
-    client_sock->type = SOCKET_TYPE_TCP_CLIENT;
-    client_sock->state = SOCKET_STATE_CONNECTED;
-    client_sock->remote_addr = client_addr;
-    client_sock->created_time = time(NULL);
-    client_sock->last_activity = client_sock->created_time;
-
-    //  ּ  
-    inet_ntop(AF_INET, &client_addr.sin_addr, client_sock->remote_ip, sizeof(client_sock->remote_ip));
-    client_sock->remote_port = ntohs(client_addr.sin_port);
-
-    LOG_INFO("Accepted connection from %s:%d", client_sock->remote_ip, client_sock->remote_port);
+    LOG_DEBUG("Accepted connection from %s:%d", client_sock->remote_ip, client_sock->remote_port);
     return client_sock;
 }
 
@@ -305,7 +368,7 @@ network_result_t network_socket_connect(network_socket_t* sock, const char* host
     }
 
     sock->state = SOCKET_STATE_CONNECTING;
-    sock->remote_addr = server_addr;
+    memcpy(&sock->remote_addr, &server_addr, sizeof(server_addr));
     utils_string_copy(sock->remote_ip, sizeof(sock->remote_ip), ip_str);
     sock->remote_port = port;
 
@@ -335,7 +398,7 @@ network_result_t network_socket_connect(network_socket_t* sock, const char* host
 
     //   (ŷ ƴ )
     sock->state = SOCKET_STATE_CONNECTED;
-    sock->last_activity = time(NULL);
+    sock->last_activity = utils_clock_now_ms();
     LOG_INFO("Connected to %s:%d", hostname, port);
     return NETWORK_SUCCESS;
 }
@@ -383,7 +446,7 @@ network_result_t network_socket_connect_check(network_socket_t* sock) {
     if (FD_ISSET(sock->handle, &write_fds)) {
         //  Ϸ
         sock->state = SOCKET_STATE_CONNECTED;
-        sock->last_activity = time(NULL);
+        sock->last_activity = utils_clock_now_ms();
         LOG_INFO("Connection completed to %s:%d", sock->remote_ip, sock->remote_port);
         return NETWORK_SUCCESS;
     }
@@ -391,6 +454,287 @@ network_result_t network_socket_connect_check(network_socket_t* sock) {
     return NETWORK_WOULD_BLOCK;
 }
 
+// =============================================================================
+// 񵿱  (IPv4/IPv6, happy eyeballs)
+// =============================================================================
+
+network_result_t network_connector_start(network_connector_t* connector, const char* hostname,
+    uint16_t port, int timeout_ms, WSAEVENT notify_event) {
+    if (!connector || utils_string_is_empty(hostname) || port == 0) {
+        return NETWORK_ERROR;
+    }
+
+    network_connector_cancel(connector);
+    memset(connector, 0, sizeof(network_connector_t));
+    for (int i = 0; i < NETWORK_CONNECT_MAX_ADDRESSES; i++) {
+        connector->attempts[i] = INVALID_SOCKET;
+    }
+    connector->newest_attempt = INVALID_SOCKET;
+    connector->notify_event = notify_event;
+    connector->port = port;
+    utils_string_copy(connector->hostname, sizeof(connector->hostname), hostname);
+
+    // IPv4 IPv6 ּҸ  ؼ (IP ͷ hosts  ̸  ȯ)
+    char port_str[8];
+    sprintf_s(port_str, sizeof(port_str), "%u", port);
+
+    struct addrinfo hints, * result;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_protocol = IPPROTO_TCP;
+
+    int ret = getaddrinfo(hostname, port_str, &hints, &result);
+    if (ret != 0) {
+        LOG_ERROR("Failed to resolve hostname %s: %s", hostname, gai_strerror(ret));
+        return NETWORK_HOST_UNREACHABLE;
+    }
+
+    // ù  ּ 迭 켱  迭  ġ (RFC 8305)
+    struct addrinfo* preferred[NETWORK_CONNECT_MAX_ADDRESSES];
+    struct addrinfo* fallback[NETWORK_CONNECT_MAX_ADDRESSES];
+    int preferred_count = 0;
+    int fallback_count = 0;
+
+    for (struct addrinfo* ai = result; ai; ai = ai->ai_next) {
+        if (ai->ai_addrlen > sizeof(struct sockaddr_storage)) {
+            continue;
+        }
+        if (ai->ai_family == result->ai_family) {
+            if (preferred_count < NETWORK_CONNECT_MAX_ADDRESSES) {
+                preferred[preferred_count++] = ai;
+            }
+        }
+        else if (fallback_count < NETWORK_CONNECT_MAX_ADDRESSES) {
+            fallback[fallback_count++] = ai;
+        }
+    }
+
+    for (int i = 0; connector->address_count < NETWORK_CONNECT_MAX_ADDRESSES &&
+        (i < preferred_count || i < fallback_count); i++) {
+        struct addrinfo* pair[2] = { i < preferred_count ? preferred[i] : NULL,
+                                     i < fallback_count ? fallback[i] : NULL };
+        for (int j = 0; j < 2 && connector->address_count < NETWORK_CONNECT_MAX_ADDRESSES; j++) {
+            if (pair[j]) {
+                memcpy(&connector->addresses[connector->address_count], pair[j]->ai_addr, pair[j]->ai_addrlen);
+                connector->address_lengths[connector->address_count] = (int)pair[j]->ai_addrlen;
+                connector->address_count++;
+            }
+        }
+    }
+    freeaddrinfo(result);
+
+    if (connector->address_count == 0) {
+        LOG_ERROR("No usable address for %s", hostname);
+        return NETWORK_HOST_UNREACHABLE;
+    }
+
+    ULONGLONG now = GetTickCount64();
+    connector->deadline_ms = now + (ULONGLONG)(timeout_ms > 0 ? timeout_ms : 0);
+    connector->next_attempt_ms = now;
+    connector->active = 1;
+
+    LOG_DEBUG("Connecting to %s:%d (%d address(es))", hostname, port, connector->address_count);
+
+    // ù õ ٷ ̾ network_connector_poll ȣ⿡ ۵
+    return NETWORK_WOULD_BLOCK;
+}
+
+network_result_t network_connector_poll(network_connector_t* connector, network_socket_t** connected) {
+    if (!connector || !connected) {
+        return NETWORK_ERROR;
+    }
+    *connected = NULL;
+
+    if (!connector->active) {
+        return NETWORK_INVALID_SOCKET;
+    }
+
+    //   õ Ȯ (    )
+    if (connector->active_attempts > 0) {
+        fd_set write_fds, error_fds;
+        struct timeval timeout = { 0, 0 };
+
+        FD_ZERO(&write_fds);
+        FD_ZERO(&error_fds);
+        for (int i = 0; i < connector->next_address; i++) {
+            if (connector->attempts[i] != INVALID_SOCKET) {
+                FD_SET(connector->attempts[i], &write_fds);
+                FD_SET(connector->attempts[i], &error_fds);
+            }
+        }
+
+        if (select(0, NULL, &write_fds, &error_fds, &timeout) == SOCKET_ERROR) {
+            LOG_ERROR("Select failed during connect: %s",
+                utils_winsock_error_to_string(WSAGetLastError()));
+            network_connector_cancel(connector);
+            return NETWORK_ERROR;
+        }
+
+        for (int i = 0; i < connector->next_address; i++) {
+            SOCKET attempt = connector->attempts[i];
+            if (attempt == INVALID_SOCKET) {
+                continue;
+            }
+
+            if (FD_ISSET(attempt, &error_fds)) {
+                int error = 0;
+                int error_len = sizeof(error);
+                getsockopt(attempt, SOL_SOCKET, SO_ERROR, (char*)&error, &error_len);
+                connector->last_error = error;
+
+                char ip[NETWORK_IP_STRING_LENGTH];
+                network_format_address((struct sockaddr*)&connector->addresses[i], ip, sizeof(ip), NULL);
+                LOG_DEBUG("Connect attempt to %s failed: %s", ip, utils_winsock_error_to_string(error));
+
+                network_connector_close_attempt(connector, i);
+                connector->next_attempt_ms = GetTickCount64();  // ϸ ٷ  ּ õ
+            }
+            else if (FD_ISSET(attempt, &write_fds)) {
+                //   õ äϰ  
+                network_socket_t* sock = network_socket_wrap_handle(attempt,
+                    (struct sockaddr*)&connector->addresses[i], connector->address_lengths[i]);
+                if (!sock) {
+                    network_connector_cancel(connector);
+                    return NETWORK_ERROR;
+                }
+
+                connector->attempts[i] = INVALID_SOCKET;
+                connector->active_attempts--;
+                network_connector_cancel(connector);
+
+                LOG_INFO("Connected to %s:%d (%s)", connector->hostname, connector->port, sock->remote_ip);
+                *connected = sock;
+                return NETWORK_SUCCESS;
+            }
+        }
+    }
+
+    ULONGLONG now = GetTickCount64();
+
+    if (now >= connector->deadline_ms) {
+        LOG_ERROR("Connection to %s:%d timed out", connector->hostname, connector->port);
+        network_connector_cancel(connector);
+        return NETWORK_TIMEOUT;
+    }
+
+    //    ּ õ  (  õ  ٸ )
+    while (connector->next_address < connector->address_count &&
+        (now >= connector->next_attempt_ms || connector->active_attempts == 0)) {
+        network_result_t attempt_result = network_connector_start_attempt(connector, connector->next_address++);
+        if (attempt_result == NETWORK_WOULD_BLOCK) {
+            connector->next_attempt_ms = now + NETWORK_CONNECT_ATTEMPT_DELAY_MS;
+            break;
+        }
+    }
+
+    if (connector->active_attempts == 0) {
+        LOG_ERROR("Connect failed to %s:%d - %s", connector->hostname, connector->port,
+            utils_winsock_error_to_string(connector->last_error));
+        network_connector_cancel(connector);
+        return network_result_from_winsock(connector->last_error);
+    }
+
+    return NETWORK_WOULD_BLOCK;
+}
+
+int network_connector_next_timeout(const network_connector_t* connector) {
+    if (!connector || !connector->active) {
+        return -1;
+    }
+
+    ULONGLONG now = GetTickCount64();
+    ULONGLONG due = connector->deadline_ms;
+    if (connector->next_address < connector->address_count && connector->next_attempt_ms < due) {
+        due = connector->next_attempt_ms;
+    }
+
+    return due <= now ? 0 : (int)(due - now);
+}
+
+SOCKET network_connector_watch_handle(const network_connector_t* connector) {
+    if (!connector || !connector->active) {
+        return INVALID_SOCKET;
+    }
+
+    return connector->newest_attempt;
+}
+
+void network_connector_cancel(network_connector_t* connector) {
+    if (!connector || !connector->active) {
+        return;
+    }
+
+    for (int i = 0; i < NETWORK_CONNECT_MAX_ADDRESSES; i++) {
+        network_connector_close_attempt(connector, i);
+    }
+
+    connector->active_attempts = 0;
+    connector->newest_attempt = INVALID_SOCKET;
+    connector->active = 0;
+}
+
+static network_result_t network_connector_start_attempt(network_connector_t* connector, int index) {
+    const struct sockaddr* addr = (const struct sockaddr*)&connector->addresses[index];
+
+    SOCKET attempt = socket(addr->sa_family, SOCK_STREAM, IPPROTO_TCP);
+    if (attempt == INVALID_SOCKET) {
+        connector->last_error = WSAGetLastError();
+        return NETWORK_ERROR;
+    }
+
+    // Ϸ ˸ ̺Ʈ   (WSAEventSelect  ŷ ٲ)
+    u_long mode = 1;
+    int setup_result = connector->notify_event != WSA_INVALID_EVENT ?
+        WSAEventSelect(attempt, connector->notify_event, FD_CONNECT) :
+        ioctlsocket(attempt, FIONBIO, &mode);
+    if (setup_result == SOCKET_ERROR) {
+        connector->last_error = WSAGetLastError();
+        closesocket(attempt);
+        return NETWORK_ERROR;
+    }
+
+    if (connect(attempt, addr, connector->address_lengths[index]) == SOCKET_ERROR) {
+        int error = WSAGetLastError();
+        if (error != WSAEWOULDBLOCK && error != WSAEINPROGRESS) {
+            connector->last_error = error;
+            closesocket(attempt);
+            return network_result_from_winsock(error);
+        }
+    }
+
+    char ip[NETWORK_IP_STRING_LENGTH];
+    network_format_address(addr, ip, sizeof(ip), NULL);
+    LOG_DEBUG("Connect attempt %d to %s:%d started", index + 1, ip, connector->port);
+
+    connector->attempts[index] = attempt;
+    connector->active_attempts++;
+    connector->newest_attempt = attempt;
+    return NETWORK_WOULD_BLOCK;
+}
+
+static void network_connector_close_attempt(network_connector_t* connector, int index) {
+    if (connector->attempts[index] == INVALID_SOCKET) {
+        return;
+    }
+
+    if (connector->newest_attempt == connector->attempts[index]) {
+        connector->newest_attempt = INVALID_SOCKET;
+    }
+
+    closesocket(connector->attempts[index]);
+    connector->attempts[index] = INVALID_SOCKET;
+    connector->active_attempts--;
+
+    //     õ   ֱ  ü
+    for (int i = index - 1; connector->newest_attempt == INVALID_SOCKET && i >= 0; i--) {
+        connector->newest_attempt = connector->attempts[i];
+    }
+    for (int i = connector->next_address - 1; connector->newest_attempt == INVALID_SOCKET && i > index; i--) {
+        connector->newest_attempt = connector->attempts[i];
+    }
+}
+
 // =============================================================================
 //  ۼ
 // =============================================================================
@@ -426,7 +770,7 @@ network_result_t network_socket_send(network_socket_t* sock, const void* data,
 
     if (bytes_sent) *bytes_sent = result;
     sock->bytes_sent += result;
-    sock->last_activity = time(NULL);
+    sock->last_activity = utils_clock_now_ms();
 
     LOG_DEBUG("Sent %d bytes", result);
     return NETWORK_SUCCESS;
@@ -470,7 +814,7 @@ network_result_t network_socket_recv(network_socket_t* sock, void* buffer,
 
     if (bytes_received) *bytes_received = result;
     sock->bytes_received += result;
-    sock->last_activity = time(NULL);
+    sock->last_activity = utils_clock_now_ms();
 
     LOG_DEBUG("Received %d bytes", result);
     return NETWORK_SUCCESS;
@@ -545,7 +889,7 @@ network_result_t network_socket_send_message(network_socket_t* sock, const messa
 
     // ޽ ۿ ȭ
     char send_buffer[MAX_MESSAGE_SIZE];
-    int serialized_size = message_serialize(msg, send_buffer, sizeof(send_buffer));
+    int serialized_size = network_socket_serialize_message(sock, msg, send_buffer, sizeof(send_buffer));
 
     if (serialized_size < 0) {
         LOG_ERROR("Failed to serialize message");
@@ -565,67 +909,378 @@ network_result_t network_socket_send_message(network_socket_t* sock, const messa
     return result;
 }
 
-message_t* network_socket_recv_message(network_socket_t* sock) {
-    if (!sock) {
+int network_socket_serialize_message(const network_socket_t* sock, const message_t* msg, char* buffer, size_t buffer_size) {
+    if (!sock || !msg || !buffer) {
+        return -1;
+    }
+
+    return sock->compact_header ?
+        message_serialize_compact(msg, buffer, buffer_size) :
+        message_serialize(msg, buffer, buffer_size);
+}
+
+// =============================================================================
+// ۽   ۽ ť
+// =============================================================================
+
+network_frame_t* network_frame_create(const message_t* msg) {
+    if (!msg) {
         return NULL;
     }
 
-    //   
-    message_header_t header;
-    network_result_t result = network_socket_recv_all(sock, &header, sizeof(header));
+    size_t total_size = message_get_total_size(msg);
+    network_frame_t* frame = (network_frame_t*)malloc(sizeof(network_frame_t) + total_size);
+    if (!frame) {
+        LOG_ERROR("Failed to allocate send frame (%zu bytes)", total_size);
+        return NULL;
+    }
 
-    if (result != NETWORK_SUCCESS) {
-        if (result != NETWORK_WOULD_BLOCK) {
-            LOG_DEBUG("Failed to receive message header: %s",
-                network_result_to_string(result));
-        }
+    int serialized_size = message_serialize(msg, frame->data, total_size);
+    if (serialized_size < 0) {
+        LOG_ERROR("Failed to serialize message");
+        free(frame);
         return NULL;
     }
 
-    //  ȿ 
-    if (!message_validate_header(&header)) {
-        LOG_ERROR("Invalid message header received");
+    frame->refcount = 1;
+    frame->msg_type = ntohs(msg->header.type);
+    frame->length = (uint32_t)serialized_size;
+    frame->compressed = NULL;
+    frame->compact = NULL;
+    frame->compress_attempted = 0;
+    return frame;
+}
+
+void network_frame_retain(network_frame_t* frame) {
+    if (frame) {
+        InterlockedIncrement(&frame->refcount);
+    }
+}
+
+void network_frame_release(network_frame_t* frame) {
+    if (frame && InterlockedDecrement(&frame->refcount) == 0) {
+        network_frame_release(frame->compressed);
+        network_frame_release(frame->compact);
+        free(frame);
+    }
+}
+
+network_frame_t* network_frame_compress(network_frame_t* frame, compress_context_t* context) {
+    if (!frame || !context) {
+        return frame;
+    }
+
+    if (frame->compress_attempted) {
+        return frame->compressed ? frame->compressed : frame;
+    }
+    frame->compress_attempted = 1;
+
+    const message_header_t* header = (const message_header_t*)frame->data;
+    uint32_t payload_size = frame->length - (uint32_t)sizeof(message_header_t);
+    if (payload_size <= COMPRESSED_FRAME_HEADER_SIZE + 1) {
+        return frame;
+    }
+
+    // ົ    ǹ̰ Ƿ   ׺ ۰ 
+    uint32_t capacity = payload_size - COMPRESSED_FRAME_HEADER_SIZE - 1;
+    size_t prefix_size = sizeof(message_header_t) + COMPRESSED_FRAME_HEADER_SIZE;
+    network_frame_t* compressed = (network_frame_t*)malloc(sizeof(network_frame_t) + prefix_size + capacity);
+    if (!compressed) {
+        return frame;
+    }
+
+    int compressed_size = compress_data(context, frame->data + sizeof(message_header_t), payload_size,
+        compressed->data + prefix_size, capacity);
+    if (compressed_size < 0) {
+        free(compressed);
+        return frame;
+    }
+
+    // [ (MSG_COMPRESSED)][ Ÿ][ ̷ε ũ][ ]
+    message_header_t compressed_header = *header;
+    compressed_header.type = htons(MSG_COMPRESSED);
+    compressed_header.payload_size = htonl(COMPRESSED_FRAME_HEADER_SIZE + (uint32_t)compressed_size);
+    memcpy(compressed->data, &compressed_header, sizeof(compressed_header));
+
+    uint32_t original_size = htonl(payload_size);
+    memcpy(compressed->data + sizeof(message_header_t), &header->type, sizeof(header->type));
+    memcpy(compressed->data + sizeof(message_header_t) + sizeof(header->type), &original_size, sizeof(original_size));
+
+    compressed->refcount = 1;
+    compressed->msg_type = frame->msg_type;
+    compressed->length = (uint32_t)(prefix_size + compressed_size);
+    compressed->compressed = NULL;
+    compressed->compact = NULL;
+    compressed->compress_attempted = 1;
+
+    frame->compressed = compressed;
+    return compressed;
+}
+
+network_frame_t* network_frame_compact(network_frame_t* frame) {
+    if (!frame) {
         return NULL;
     }
 
-    uint32_t payload_size = ntohl(header.payload_size);
+    if (frame->compact) {
+        return frame->compact;
+    }
 
-    // ü ޽  Ҵ
-    size_t total_size = sizeof(message_header_t) + payload_size;
-    char* message_buffer = (char*)malloc(total_size);
-    if (!message_buffer) {
-        LOG_ERROR("Failed to allocate memory for message (%zu bytes)", total_size);
+    const message_header_t* header = (const message_header_t*)frame->data;
+    uint32_t payload_size = frame->length - (uint32_t)sizeof(message_header_t);
+
+    network_frame_t* compact = (network_frame_t*)malloc(sizeof(network_frame_t) + COMPACT_HEADER_MAX_SIZE + payload_size);
+    if (!compact) {
+        return frame;
+    }
+
+    int header_size = message_encode_compact_header(ntohs(header->type), payload_size, (uint8_t*)compact->data);
+    memcpy(compact->data + header_size, frame->data + sizeof(message_header_t), payload_size);
+
+    compact->refcount = 1;
+    compact->msg_type = frame->msg_type;
+    compact->length = (uint32_t)header_size + payload_size;
+    compact->compressed = NULL;
+    compact->compact = NULL;
+    compact->compress_attempted = 1;
+
+    frame->compact = compact;
+    return compact;
+}
+
+network_frame_t* network_frame_create_batch(network_frame_t* const* frames, int count) {
+    if (!frames || count <= 0) {
         return NULL;
     }
 
-    //  
-    memcpy(message_buffer, &header, sizeof(header));
+    uint32_t payload_size = 0;
+    for (int i = 0; i < count; i++) {
+        payload_size += NETWORK_BATCH_ITEM_SIZE(frames[i]);
+    }
 
-    // ̷ε  (ִ )
-    if (payload_size > 0) {
-        result = network_socket_recv_all(sock, message_buffer + sizeof(header), payload_size);
+    if (payload_size > NETWORK_BATCH_PAYLOAD_LIMIT) {
+        LOG_ERROR("Batch of %d frames is too large (%u bytes)", count, payload_size);
+        return NULL;
+    }
 
-        if (result != NETWORK_SUCCESS) {
-            LOG_ERROR("Failed to receive message payload: %s",
-                network_result_to_string(result));
-            free(message_buffer);
-            return NULL;
+    uint32_t total_size = (uint32_t)sizeof(message_header_t) + payload_size;
+    network_frame_t* batch = (network_frame_t*)malloc(sizeof(network_frame_t) + total_size);
+    if (!batch) {
+        LOG_ERROR("Failed to allocate batch frame (%u bytes)", total_size);
+        return NULL;
+    }
+
+    message_header_t header;
+    header.magic = htonl(PROTOCOL_MAGIC);
+    header.version = htons(PROTOCOL_VERSION);
+    header.type = htons(MSG_BATCH);
+    header.payload_size = htonl(payload_size);
+    memcpy(batch->data, &header, sizeof(header));
+
+    //    ׸  ٲ ̷ε常 ̾ 
+    char* cursor = batch->data + sizeof(header);
+    for (int i = 0; i < count; i++) {
+        const message_header_t* source = (const message_header_t*)frames[i]->data;
+        uint32_t item_size = frames[i]->length - (uint32_t)sizeof(message_header_t);
+
+        batch_item_header_t item_header;
+        item_header.type = source->type;
+        item_header.payload_size = htons((uint16_t)item_size);
+        memcpy(cursor, &item_header, sizeof(item_header));
+        cursor += sizeof(item_header);
+
+        memcpy(cursor, frames[i]->data + sizeof(message_header_t), item_size);
+        cursor += item_size;
+    }
+
+    batch->refcount = 1;
+    batch->msg_type = MSG_BATCH;
+    batch->length = total_size;
+    batch->compressed = NULL;
+    batch->compact = NULL;
+    batch->compress_attempted = 0;
+    return batch;
+}
+
+network_result_t network_socket_enable_compact_header(network_socket_t* sock) {
+    if (!sock) {
+        return NETWORK_INVALID_SOCKET;
+    }
+
+    sock->compact_header = 1;
+    return NETWORK_SUCCESS;
+}
+
+network_result_t network_socket_enable_compression(network_socket_t* sock) {
+    if (!sock) {
+        return NETWORK_INVALID_SOCKET;
+    }
+
+    if (!sock->codec) {
+        sock->codec = compress_context_create();
+        if (!sock->codec) {
+            return NETWORK_ERROR;
         }
     }
 
-    // ޽ ȭ
-    message_t* msg = message_deserialize(message_buffer, total_size);
-    free(message_buffer);
+    return NETWORK_SUCCESS;
+}
+
+int network_send_queue_push(network_send_queue_t* queue, network_frame_t* frame) {
+    if (!queue || !frame || queue->count >= NETWORK_SEND_QUEUE_CAPACITY) {
+        return -1;
+    }
+
+    network_frame_retain(frame);
+    queue->frames[(queue->head + queue->count) % NETWORK_SEND_QUEUE_CAPACITY] = frame;
+    queue->count++;
+    queue->queued_bytes += frame->length;
+    return 0;
+}
+
+void network_send_queue_clear(network_send_queue_t* queue) {
+    if (!queue) {
+        return;
+    }
+
+    for (int i = 0; i < queue->count; i++) {
+        network_frame_release(queue->frames[(queue->head + i) % NETWORK_SEND_QUEUE_CAPACITY]);
+    }
+
+    queue->head = 0;
+    queue->count = 0;
+    queue->head_offset = 0;
+    queue->queued_bytes = 0;
+}
+
+void network_socket_discard_queue(network_socket_t* sock, network_send_queue_t* queue) {
+    if (!queue) {
+        return;
+    }
+
+    if (queue->zerocopy_pending && sock && sock->handle != INVALID_SOCKET) {
+        DWORD bytes = 0;
+        DWORD flags = 0;
+        CancelIoEx((HANDLE)sock->handle, &queue->zerocopy_overlapped);
+        WSAGetOverlappedResult(sock->handle, &queue->zerocopy_overlapped, &bytes, TRUE, &flags);
+    }
+    queue->zerocopy_pending = 0;
+
+    network_send_queue_clear(queue);
+}
+
+network_result_t network_socket_flush_queue(network_socket_t* sock, network_send_queue_t* queue,
+    network_frame_sent_t on_sent, void* context) {
+    if (!sock || sock->handle == INVALID_SOCKET || !queue) {
+        return NETWORK_INVALID_SOCKET;
+    }
+
+    if (sock->state != SOCKET_STATE_CONNECTED) {
+        return NETWORK_DISCONNECTED;
+    }
+
+    while (queue->count > 0) {
+        DWORD bytes_sent = 0;
+
+        if (queue->zerocopy_pending) {
+            //   ī   ۸ ְ    ( )
+            DWORD flags = 0;
+            if (!WSAGetOverlappedResult(sock->handle, &queue->zerocopy_overlapped, &bytes_sent, FALSE, &flags)) {
+                int error = WSAGetLastError();
+                if (error == WSA_IO_INCOMPLETE) {
+                    return NETWORK_WOULD_BLOCK;
+                }
+
+                queue->zerocopy_pending = 0;
+                return network_flush_error(sock, error);
+            }
+
+            queue->zerocopy_pending = 0;
+            queue->zerocopy_completions++;
+            network_send_queue_complete(sock, queue, bytes_sent, on_sent, context);
+            continue;
+        }
+
+        //     迭  (     ġ)
+        WSABUF buffers[NETWORK_FLUSH_MAX_BUFFERS];
+        DWORD buffer_count = 0;
+        uint32_t requested = 0;
+
+        for (int i = 0; i < queue->count && buffer_count < NETWORK_FLUSH_MAX_BUFFERS; i++) {
+            network_frame_t* frame = queue->frames[(queue->head + i) % NETWORK_SEND_QUEUE_CAPACITY];
+            uint32_t offset = (i == 0) ? queue->head_offset : 0;
+
+            buffers[buffer_count].buf = frame->data + offset;
+            buffers[buffer_count].len = frame->length - offset;
+            requested += frame->length - offset;
+            buffer_count++;
+        }
+
+        queue->send_calls++;
+
+        // ū  overlapped Ѱ Ŀ  ӿ ٷ   (   )
+        // WSABUF 迭 ȣ ߿ ǹǷ ÿ ־ ǰ,  Ϸ  ť  
+        if (queue->zerocopy_threshold > 0 && requested >= queue->zerocopy_threshold) {
+            memset(&queue->zerocopy_overlapped, 0, sizeof(queue->zerocopy_overlapped));
+            queue->zerocopy_sends++;
+
+            if (WSASend(sock->handle, buffers, buffer_count, NULL, 0, &queue->zerocopy_overlapped, NULL) == SOCKET_ERROR) {
+                int error = WSAGetLastError();
+                if (error != WSA_IO_PENDING) {
+                    return network_flush_error(sock, error);
+                }
+            }
+
+            // ٷ Ϸƾ  overlapped ü Ƿ  ݺ ó
+            queue->zerocopy_pending = 1;
+            continue;
+        }
+
+        if (WSASend(sock->handle, buffers, buffer_count, &bytes_sent, 0, NULL, NULL) == SOCKET_ERROR) {
+            int error = WSAGetLastError();
+            if (error == WSAEWOULDBLOCK) {
+                return NETWORK_WOULD_BLOCK;
+            }
+            return network_flush_error(sock, error);
+        }
+
+        network_send_queue_complete(sock, queue, bytes_sent, on_sent, context);
+
+        // Ϻθ  ۽ ۰   ̹Ƿ    ̾ 
+        if (bytes_sent < requested) {
+            return NETWORK_WOULD_BLOCK;
+        }
+    }
+
+    return NETWORK_SUCCESS;
+}
+
+message_t* network_socket_recv_message(network_socket_t* sock) {
+    if (!sock) {
+        return NULL;
+    }
+
+    message_t* msg = sock->compact_header ?
+        network_recv_compact_message(sock) : network_recv_full_message(sock);
 
     if (!msg) {
-        LOG_ERROR("Failed to deserialize received message");
         return NULL;
     }
 
+    //   ⼭  ޽ ϹǷ ȣڴ  θ  ʿ 
+    if (ntohs(msg->header.type) == MSG_COMPRESSED) {
+        message_t* decoded = network_decompress_message(sock, msg);
+        message_destroy(msg);
+        if (!decoded) {
+            return NULL;
+        }
+        msg = decoded;
+    }
+
     sock->messages_received++;
     LOG_DEBUG("Received message type %s (%u bytes payload)",
         message_type_to_string((message_type_t)ntohs(msg->header.type)),
-        payload_size);
+        ntohl(msg->header.payload_size));
 
     return msg;
 }
@@ -713,10 +1368,114 @@ int network_socket_can_write(network_socket_t* sock, int timeout_ms) {
     return (result > 0 && FD_ISSET(sock->handle, &write_fds)) ? 1 : 0;
 }
 
+// =============================================================================
+// պ ð 
+// =============================================================================
+
+uint32_t network_rtt_timestamp(void) {
+    static LARGE_INTEGER frequency = { 0 };
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    uint32_t timestamp = (uint32_t)((now.QuadPart / frequency.QuadPart) * 1000000 +
+        (now.QuadPart % frequency.QuadPart) * 1000000 / frequency.QuadPart);
+    return timestamp != 0 ? timestamp : 1;
+}
+
+double network_rtt_elapsed_ms(uint32_t timestamp) {
+    // ȣ  ̹Ƿ 71 ȿ ȯص 
+    return (double)(uint32_t)(network_rtt_timestamp() - timestamp) / 1000.0;
+}
+
+void network_rtt_update(network_rtt_t* rtt, double sample_ms) {
+    if (!rtt || sample_ms < 0.0) {
+        return;
+    }
+
+    if (rtt->samples == 0) {
+        rtt->srtt_ms = sample_ms;
+        rtt->rttvar_ms = sample_ms / 2.0;
+    }
+    else {
+        double deviation = rtt->srtt_ms > sample_ms ? rtt->srtt_ms - sample_ms : sample_ms - rtt->srtt_ms;
+        rtt->rttvar_ms = 0.75 * rtt->rttvar_ms + 0.25 * deviation;
+        rtt->srtt_ms = 0.875 * rtt->srtt_ms + 0.125 * sample_ms;
+    }
+
+    rtt->last_ms = sample_ms;
+    rtt->samples++;
+}
+
+double network_rtt_timeout_ms(const network_rtt_t* rtt) {
+    if (!rtt || rtt->samples == 0) {
+        return 0.0;
+    }
+    return rtt->srtt_ms + 4.0 * rtt->rttvar_ms;
+}
+
 // =============================================================================
 // ƿƼ Լ
 // =============================================================================
 
+static network_socket_t* network_socket_wrap_handle(SOCKET handle, const struct sockaddr* addr, int addr_len) {
+    network_socket_t* sock = (network_socket_t*)calloc(1, sizeof(network_socket_t));
+    if (!sock) {
+        LOG_ERROR("Failed to allocate memory for socket");
+        return NULL;
+    }
+
+    sock->handle = handle;
+    sock->type = SOCKET_TYPE_TCP_CLIENT;
+    sock->state = SOCKET_STATE_CONNECTED;
+    sock->created_time = utils_clock_now_ms();
+    sock->last_activity = sock->created_time;
+
+    //  ּ  
+    if (addr && addr_len > 0 && addr_len <= (int)sizeof(sock->remote_addr)) {
+        memcpy(&sock->remote_addr, addr, addr_len);
+        network_format_address(addr, sock->remote_ip, sizeof(sock->remote_ip), &sock->remote_port);
+    }
+
+    return sock;
+}
+
+static void network_format_address(const struct sockaddr* addr, char* ip_buffer, size_t buffer_size, uint16_t* port) {
+    const void* ip_addr = NULL;
+    uint16_t net_port = 0;
+
+    if (addr->sa_family == AF_INET6) {
+        const struct sockaddr_in6* addr6 = (const struct sockaddr_in6*)addr;
+        ip_addr = &addr6->sin6_addr;
+        net_port = addr6->sin6_port;
+    }
+    else {
+        const struct sockaddr_in* addr4 = (const struct sockaddr_in*)addr;
+        ip_addr = &addr4->sin_addr;
+        net_port = addr4->sin_port;
+    }
+
+    if (inet_ntop(addr->sa_family, ip_addr, ip_buffer, (socklen_t)buffer_size) == NULL) {
+        utils_string_copy(ip_buffer, buffer_size, "?");
+    }
+
+    if (port) {
+        *port = ntohs(net_port);
+    }
+}
+
+static network_result_t network_result_from_winsock(int error) {
+    switch (error) {
+    case WSAECONNREFUSED:   return NETWORK_CONNECTION_REFUSED;
+    case WSAEHOSTUNREACH:
+    case WSAENETUNREACH:    return NETWORK_HOST_UNREACHABLE;
+    case WSAETIMEDOUT:      return NETWORK_TIMEOUT;
+    default:                return NETWORK_ERROR;
+    }
+}
+
 const char* network_addr_to_string(const struct sockaddr_in* addr, char* buffer, size_t buffer_size) {
     if (!addr || !buffer || buffer_size < 16) {
         return NULL;
@@ -801,7 +1560,7 @@ void network_socket_print_stats(const network_socket_t* sock) {
     }
 
     char size_buffer[32];
-    time_t uptime = time(NULL) - sock->created_time;
+    uint64_t now_ms = utils_clock_now_ms();
 
     printf("=== Socket Statistics ===\n");
     printf("Handle: %d\n", (int)sock->handle);
@@ -811,8 +1570,8 @@ void network_socket_print_stats(const network_socket_t* sock) {
     printf("Bytes received: %s\n", utils_bytes_to_human_readable(sock->bytes_received, size_buffer, sizeof(size_buffer)));
     printf("Messages sent: %u\n", sock->messages_sent);
     printf("Messages received: %u\n", sock->messages_received);
-    printf("Uptime: %d seconds\n", (int)uptime);
-    printf("Last activity: %d seconds ago\n", (int)(time(NULL) - sock->last_activity));
+    printf("Uptime: %d seconds\n", (int)(utils_clock_elapsed_ms(sock->created_time, now_ms) / 1000));
+    printf("Last activity: %d seconds ago\n", (int)(utils_clock_elapsed_ms(sock->last_activity, now_ms) / 1000));
 }
 
 const char* network_get_local_ip(char* buffer, size_t buffer_size) {
@@ -828,4 +1587,192 @@ const char* network_get_local_ip(char* buffer, size_t buffer_size) {
     }
 
     return network_resolve_hostname(hostname, buffer, buffer_size) == NETWORK_SUCCESS ? buffer : NULL;
-}
\ No newline at end of file
+}
+
+static void network_send_queue_complete(network_socket_t* sock, network_send_queue_t* queue, uint32_t bytes,
+    network_frame_sent_t on_sent, void* context) {
+    sock->bytes_sent += bytes;
+    sock->last_activity = utils_clock_now_ms();
+    if (queue->segment_size > 0) {
+        queue->segments_estimated += (bytes + queue->segment_size - 1) / queue->segment_size;
+    }
+    network_send_queue_consume(queue, bytes, on_sent, context);
+}
+
+static network_result_t network_flush_error(network_socket_t* sock, int error) {
+    if (error == WSAECONNRESET || error == WSAECONNABORTED || error == WSA_OPERATION_ABORTED) {
+        sock->state = SOCKET_STATE_DISCONNECTING;
+        return NETWORK_DISCONNECTED;
+    }
+
+    LOG_ERROR("Send failed: %s", utils_winsock_error_to_string(error));
+    return NETWORK_ERROR;
+}
+
+static void network_send_queue_consume(network_send_queue_t* queue, uint32_t bytes,
+    network_frame_sent_t on_sent, void* context) {
+    queue->queued_bytes -= bytes;
+
+    while (bytes > 0 && queue->count > 0) {
+        network_frame_t* frame = queue->frames[queue->head];
+        uint32_t remaining = frame->length - queue->head_offset;
+
+        if (bytes < remaining) {
+            queue->head_offset += bytes;  //  ߰ 
+            return;
+        }
+
+        bytes -= remaining;
+        if (on_sent) {
+            on_sent(frame, context);
+        }
+
+        network_frame_release(frame);
+        queue->frames[queue->head] = NULL;
+        queue->head = (queue->head + 1) % NETWORK_SEND_QUEUE_CAPACITY;
+        queue->count--;
+        queue->head_offset = 0;
+    }
+}
+
+static message_t* network_decompress_message(network_socket_t* sock, const message_t* msg) {
+    if (!sock->codec) {
+        LOG_ERROR("Received compressed frame without negotiated compression");
+        return NULL;
+    }
+
+    uint32_t payload_size = ntohl(msg->header.payload_size);
+    if (payload_size <= COMPRESSED_FRAME_HEADER_SIZE) {
+        LOG_ERROR("Compressed frame too short (%u bytes)", payload_size);
+        return NULL;
+    }
+
+    uint16_t original_type;
+    uint32_t original_size;
+    memcpy(&original_type, msg->payload, sizeof(original_type));
+    memcpy(&original_size, msg->payload + sizeof(original_type), sizeof(original_size));
+    original_type = ntohs(original_type);
+    original_size = ntohl(original_size);
+
+    if (original_size == 0 || original_size > MAX_MESSAGE_SIZE - sizeof(message_header_t)) {
+        LOG_ERROR("Invalid original size in compressed frame: %u", original_size);
+        return NULL;
+    }
+
+    char* buffer = (char*)malloc(original_size);
+    if (!buffer) {
+        LOG_ERROR("Failed to allocate %u bytes for decompression", original_size);
+        return NULL;
+    }
+
+    message_t* decoded = NULL;
+    if (compress_decompress_data(sock->codec, msg->payload + COMPRESSED_FRAME_HEADER_SIZE,
+        payload_size - COMPRESSED_FRAME_HEADER_SIZE, buffer, original_size) == 0) {
+        decoded = message_create((message_type_t)original_type, buffer, original_size);
+    }
+
+    free(buffer);
+    return decoded;
+}
+
+static message_t* network_recv_full_message(network_socket_t* sock) {
+    //   
+    message_header_t header;
+    network_result_t result = network_socket_recv_all(sock, &header, sizeof(header));
+
+    if (result != NETWORK_SUCCESS) {
+        if (result != NETWORK_WOULD_BLOCK) {
+            LOG_DEBUG("Failed to receive message header: %s",
+                network_result_to_string(result));
+        }
+        return NULL;
+    }
+
+    //  ȿ 
+    if (!message_validate_header(&header)) {
+        LOG_ERROR("Invalid message header received");
+        return NULL;
+    }
+
+    uint32_t payload_size = ntohl(header.payload_size);
+
+    // ü ޽  Ҵ
+    size_t total_size = sizeof(message_header_t) + payload_size;
+    char* message_buffer = (char*)malloc(total_size);
+    if (!message_buffer) {
+        LOG_ERROR("Failed to allocate memory for message (%zu bytes)", total_size);
+        return NULL;
+    }
+
+    //  
+    memcpy(message_buffer, &header, sizeof(header));
+
+    // ̷ε  (ִ )
+    if (payload_size > 0) {
+        result = network_socket_recv_all(sock, message_buffer + sizeof(header), payload_size);
+
+        if (result != NETWORK_SUCCESS) {
+            LOG_ERROR("Failed to receive message payload: %s",
+                network_result_to_string(result));
+            free(message_buffer);
+            return NULL;
+        }
+    }
+
+    // ޽ ȭ
+    message_t* msg = message_deserialize(message_buffer, total_size);
+    free(message_buffer);
+
+    if (!msg) {
+        LOG_ERROR("Failed to deserialize received message");
+    }
+    return msg;
+}
+
+static message_t* network_recv_compact_message(network_socket_t* sock) {
+    //  ª ŭ  ް ũⰡ 2Ʈ varint  1Ʈ  
+    uint8_t header[COMPACT_HEADER_MAX_SIZE];
+    network_result_t result = network_socket_recv_all(sock, header, COMPACT_HEADER_MIN_SIZE);
+    if (result == NETWORK_SUCCESS && (header[2] & 0x80)) {
+        result = network_socket_recv_all(sock, header + COMPACT_HEADER_MIN_SIZE, 1);
+    }
+
+    if (result != NETWORK_SUCCESS) {
+        if (result != NETWORK_WOULD_BLOCK) {
+            LOG_DEBUG("Failed to receive compact header: %s", network_result_to_string(result));
+        }
+        return NULL;
+    }
+
+    uint16_t type;
+    uint32_t payload_size;
+    if (message_decode_compact_header(header, COMPACT_HEADER_MAX_SIZE, &type, &payload_size) <= 0) {
+        LOG_ERROR("Invalid compact header received");
+        return NULL;
+    }
+
+    message_t* msg = message_create((message_type_t)type, NULL, 0);
+    if (!msg) {
+        return NULL;
+    }
+
+    // ̷ε ޽ ۷ ٷ  (߰   )
+    if (payload_size > 0) {
+        msg->payload = (char*)malloc(payload_size);
+        if (!msg->payload) {
+            LOG_ERROR("Failed to allocate memory for message (%u bytes)", payload_size);
+            message_destroy(msg);
+            return NULL;
+        }
+        msg->header.payload_size = htonl(payload_size);
+
+        result = network_socket_recv_all(sock, msg->payload, (int)payload_size);
+        if (result != NETWORK_SUCCESS) {
+            LOG_ERROR("Failed to receive message payload: %s", network_result_to_string(result));
+            message_destroy(msg);
+            return NULL;
+        }
+    }
+
+    return msg;
+}
@@ -5,15 +5,29 @@
 #include "common_headers.h"  // Windows + ǥ 
 #include "protocol.h"        //  
 #include "message.h"
+#include "compress.h"
 
 // =============================================================================
 // Ʈũ  
 // =============================================================================
 
 #define NETWORK_BUFFER_SIZE         8192    // ⺻ Ʈũ  ũ
-#define MAX_PENDING_CONNECTIONS     10      //    
+#define MAX_PENDING_CONNECTIONS     10      //     (listen ⺻)
+#define NETWORK_LISTEN_BACKLOG_MAX  65535   // û  ִ ִ ⿭ ũ
+#define NETWORK_LISTEN_BACKLOG_HINT 200     // ̺ ũ SOMAXCONN_HINT û (Ϲ  200 ߸)
 #define SOCKET_TIMEOUT_MS          5000     //  ŸӾƿ (и)
 #define MAX_HOSTNAME_LENGTH         256     // ִ ȣƮ 
+#define NETWORK_IP_STRING_LENGTH    46      // IP ڿ ִ  (INET6_ADDRSTRLEN)
+#define NETWORK_CONNECT_MAX_ADDRESSES 8     //  õ ִ ּ 
+#define NETWORK_CONNECT_ATTEMPT_DELAY_MS 250 //  ּ õ   ð (RFC 8305 尪)
+#define NETWORK_SEND_QUEUE_CAPACITY 1024    // Ằ ׾   ִ ִ ۽  
+#define NETWORK_FLUSH_MAX_BUFFERS   64      // WSASend   ѱ ִ  
+#define NETWORK_DEFAULT_MSS         1460    // MSS ȸ    ׸Ʈ    
+
+//   ũ  (׸    4Ʈ ׸  )
+#define NETWORK_BATCH_PAYLOAD_LIMIT (MAX_MESSAGE_SIZE - (uint32_t)sizeof(message_header_t))
+#define NETWORK_BATCH_ITEM_SIZE(frame) \
+    ((frame)->length - (uint32_t)sizeof(message_header_t) + (uint32_t)sizeof(batch_item_header_t))
 
 //  ۾  ڵ
 typedef enum {
@@ -57,8 +71,8 @@ typedef struct {
 
     // ּ 
     struct sockaddr_in local_addr;          //  ּ
-    struct sockaddr_in remote_addr;         //  ּ
-    char remote_ip[16];                     //  IP ( ǥ)
+    struct sockaddr_storage remote_addr;    //  ּ (IPv4 Ǵ IPv6)
+    char remote_ip[NETWORK_IP_STRING_LENGTH]; //  IP ڿ
     uint16_t remote_port;                   //  Ʈ
 
     //  
@@ -72,10 +86,75 @@ typedef struct {
     uint64_t bytes_received;                //  Ʈ 
     uint32_t messages_sent;                 //  ޽ 
     uint32_t messages_received;             //  ޽ 
-    time_t created_time;                    //  ð
-    time_t last_activity;                   //  Ȱ ð
+    uint64_t created_time;                  //  ð (utils_clock_now_ms )
+
+    compress_context_t* codec;              //   ؽƮ (  Ḹ, ƴϸ NULL)
+    int compact_header;                     //      (  )
+    uint64_t last_activity;                 //  Ȱ ð (utils_clock_now_ms )
 } network_socket_t;
 
+// 񵿱  (ؼ  ּҿ  ΰ ķ  õ, happy eyeballs)
+typedef struct {
+    struct sockaddr_storage addresses[NETWORK_CONNECT_MAX_ADDRESSES]; // õ  ĵ ּ
+    int address_lengths[NETWORK_CONNECT_MAX_ADDRESSES];
+    int address_count;                      // ؼ ּ 
+    int next_address;                       //  õ ּ ε
+
+    SOCKET attempts[NETWORK_CONNECT_MAX_ADDRESSES]; // ּҺ   õ (INVALID_SOCKET̸ )
+    int active_attempts;                    //   õ 
+    SOCKET newest_attempt;                  //  ֱٿ  õ
+
+    ULONGLONG next_attempt_ms;              //  õ  ð (GetTickCount64 )
+    ULONGLONG deadline_ms;                  // ü  ŸӾƿ ð
+    WSAEVENT notify_event;                  // õ  FD_CONNECT ˸ ̺Ʈ ( WSA_INVALID_EVENT)
+
+    char hostname[MAX_HOSTNAME_LENGTH];     //  ȣƮ
+    uint16_t port;                          //  Ʈ
+    int last_error;                         //  õ   (Winsock  ڵ)
+    int active;                             //   ̸ 1
+} network_connector_t;
+
+// ȭ ۽  (εĳƮ   ȭ   ť )
+typedef struct network_frame_s {
+    volatile LONG refcount;                 //   (0 Ǹ )
+    uint16_t msg_type;                      // ޽ Ÿ (ȣƮ Ʈ , /Ʈ̽, ົ  Ÿ)
+    uint32_t length;                        //   ( + ̷ε)
+    struct network_frame_s* compressed;     // ົ ĳ (  ᳢ )
+    struct network_frame_s* compact;        //   ĳ (   ᳢ )
+    int compress_attempted;                 //  ̹ õ 1 (̵  compressed NULL)
+    char data[];                            // ̾  Ʈ
+} network_frame_t;
+
+// Ằ ۽ ť (̺Ʈ        )
+typedef struct {
+    network_frame_t* frames[NETWORK_SEND_QUEUE_CAPACITY]; //   ( )
+    int head;                               //    ġ
+    int count;                              //    
+    uint32_t head_offset;                   //   ӿ ̹  Ʈ  (κ  簳 ġ)
+    uint32_t queued_bytes;                  //    Ʈ 
+    uint32_t send_calls;                    //  WSASend ȣ 
+    uint32_t segment_size;                  // ׸Ʈ    MSS (0̸  )
+    uint64_t segments_estimated;            //   TCP ׸Ʈ  (ȣ⸶ ø( Ʈ / MSS))
+
+    //  ī  (SO_SNDBUF=0 Ͽ overlapped WSASend, Ϸ   ť  )
+    uint32_t zerocopy_threshold;            //    Ʈ  ̸̻  ī (0̸   )
+    WSAOVERLAPPED zerocopy_overlapped;      //    ī 
+    int zerocopy_pending;                   // ϷḦ ٸ  ī   1
+    uint32_t zerocopy_sends;                //   ī  
+    uint32_t zerocopy_completions;          //  Ϸ  ī  
+} network_send_queue_t;
+
+//  ϳ    ȣǴ ݹ (/Ʈ̽)
+typedef void (*network_frame_sent_t)(const network_frame_t* frame, void* context);
+
+// Ằ պ ð  (RFC 6298  Ȱ RTT )
+typedef struct {
+    double srtt_ms;                         // Ȱ RTT
+    double rttvar_ms;                       // RTT 
+    double last_ms;                         //  ǥ
+    uint32_t samples;                       // ǥ  (0̸   )
+} network_rtt_t;
+
 // =============================================================================
 // Ʈũ ʱȭ/
 // =============================================================================
@@ -129,6 +208,29 @@ network_result_t network_socket_set_nonblocking(network_socket_t* sock);
  */
 network_result_t network_socket_set_reuse_addr(network_socket_t* sock, int enable);
 
+/**
+ * TCP_NODELAY  (Nagle ˰ Ȱȭ)
+ * @param sock 
+ * @param enable 1̸   , 0̸ Nagle 
+ * @return  ڵ
+ */
+network_result_t network_socket_set_nodelay(network_socket_t* sock, int enable);
+
+/**
+ * ۽  ũ  (0̸ Ŀ ø̼ ۿ ٷ )
+ * @param sock 
+ * @param size Ʈ 
+ * @return  ڵ
+ */
+network_result_t network_socket_set_send_buffer(network_socket_t* sock, int size);
+
+/**
+ *  ִ ׸Ʈ ũ(MSS) ȸ
+ * @param sock  
+ * @return MSS Ʈ , ȸ   NETWORK_DEFAULT_MSS
+ */
+uint32_t network_socket_get_mss(network_socket_t* sock);
+
 /**
  *  ŸӾƿ 
  * @param sock  
@@ -153,7 +255,7 @@ network_result_t network_socket_bind(network_socket_t* sock, uint16_t port, cons
 /**
  *     ȯ
  * @param sock  
- * @param backlog ⿭ ũ (⺻: MAX_PENDING_CONNECTIONS)
+ * @param backlog ⿭ ũ (0 ̸ MAX_PENDING_CONNECTIONS, ִ NETWORK_LISTEN_BACKLOG_MAX)
  * @return   NETWORK_SUCCESS
  */
 network_result_t network_socket_listen(network_socket_t* sock, int backlog);
@@ -185,6 +287,53 @@ network_result_t network_socket_connect(network_socket_t* sock, const char* host
  */
 network_result_t network_socket_connect_check(network_socket_t* sock);
 
+// =============================================================================
+// 񵿱  (IPv4/IPv6, happy eyeballs)
+// =============================================================================
+
+/**
+ * ȣƮ  ּ(IPv4, IPv6) ؼϰ  غ
+ * ּҴ ù  ּ 迭  迭  õϸ,
+ * ù õ ̾ ȣϴ network_connector_poll ۵
+ * @param connector 
+ * @param hostname  ȣƮ Ǵ IP
+ * @param port  Ʈ
+ * @param timeout_ms ü  ŸӾƿ (и)
+ * @param notify_event õ  FD_CONNECT ˸ ̺Ʈ (WSA_INVALID_EVENT   )
+ * @return  NETWORK_WOULD_BLOCK,    ڵ
+ */
+network_result_t network_connector_start(network_connector_t* connector, const char* hostname,
+    uint16_t port, int timeout_ms, WSAEVENT notify_event);
+
+/**
+ *   õ ϷḦ Ȯϰ    ּ õ  (ŷ )
+ * õ ϸ  ð  ٷ  ּҸ õ
+ * @param connector 
+ * @param connected     ()
+ * @return   NETWORK_SUCCESS,  ̸ NETWORK_WOULD_BLOCK,    ڵ
+ */
+network_result_t network_connector_poll(network_connector_t* connector, network_socket_t** connected);
+
+/**
+ *  network_connector_poll ҷ ϴ ð  ð
+ * @param connector 
+ * @return и (  ƴϸ -1)
+ */
+int network_connector_next_timeout(const network_connector_t* connector);
+
+/**
+ * Ϸ ⿡   ( ֱٿ  õ)
+ * @param connector 
+ * @return  ڵ,   ƴϸ INVALID_SOCKET
+ */
+SOCKET network_connector_watch_handle(const network_connector_t* connector);
+
+/**
+ *    õ 
+ * @param connector 
+ */
+void network_connector_cancel(network_connector_t* connector);
+
 // =============================================================================
 //  ۼ
 // =============================================================================
@@ -241,6 +390,110 @@ network_result_t network_socket_recv_all(network_socket_t* sock, void* buffer, i
  */
 network_result_t network_socket_send_message(network_socket_t* sock, const message_t* msg);
 
+/**
+ * Ͽ   (  Ǵ 12Ʈ ) ޽ ȭ
+ *  ޽  network_socket_send_all     
+ * @param sock 
+ * @param msg ޽
+ * @param buffer  
+ * @param buffer_size  ũ
+ * @return ȭ Ʈ ,   -1
+ */
+int network_socket_serialize_message(const network_socket_t* sock, const message_t* msg, char* buffer, size_t buffer_size);
+
+/**
+ * ޽   ۽  ȭ (  1)
+ * @param msg ޽
+ * @return ,   NULL
+ */
+network_frame_t* network_frame_create(const message_t* msg);
+
+/**
+ *   ߰
+ * @param frame 
+ */
+void network_frame_retain(network_frame_t* frame);
+
+/**
+ *    (  ޸ )
+ * @param frame  (NULL )
+ */
+void network_frame_release(network_frame_t* frame);
+
+/**
+ *  ົ ȯ (ó û     ӿ ĳ)
+ *  ۾   ״ ȯ
+ * @param frame  
+ * @param context  ؽƮ
+ * @return   (ົ̸    )
+ */
+network_frame_t* network_frame_compress(network_frame_t* frame, compress_context_t* context);
+
+/**
+ *    ȯ (ó û     ӿ ĳ)
+ * @param frame   
+ * @return   (ϸ ),    
+ */
+network_frame_t* network_frame_compact(network_frame_t* frame);
+
+/**
+ *      MSG_BATCH  ϳ 
+ * NETWORK_BATCH_ITEM_SIZE հ谡 NETWORK_BATCH_PAYLOAD_LIMIT Ͽ 
+ * @param frames   迭 ( ״ )
+ * @param count  
+ * @return   (  1),   NULL
+ */
+network_frame_t* network_frame_create_batch(network_frame_t* const* frames, int count);
+
+/**
+ *  ۼ    ȯ
+ * @param sock 
+ * @return  ڵ
+ */
+network_result_t network_socket_enable_compact_header(network_socket_t* sock);
+
+/**
+ *  MSG_COMPRESSED  Ǯ  ֵ   ؽƮ غ
+ * @param sock 
+ * @return  ڵ
+ */
+network_result_t network_socket_enable_compression(network_socket_t* sock);
+
+/**
+ * ۽ ť   ߰ (ť  ϳ )
+ * @param queue ۽ ť
+ * @param frame 
+ * @return   0, ť   -1
+ */
+int network_send_queue_push(network_send_queue_t* queue, network_frame_t* frame);
+
+/**
+ * ۽ ť   
+ * @param queue ۽ ť
+ */
+void network_send_queue_clear(network_send_queue_t* queue);
+
+/**
+ *    ī  ϰ ۽ ť   
+ * Ŀ  а ִ ۸  ʵ  Ϸ ٸ
+ * @param sock 
+ * @param queue ۽ ť
+ */
+void network_socket_discard_queue(network_socket_t* sock, network_send_queue_t* queue);
+
+/**
+ * ۽ ť  WSABUF 迭  WSASend  (ŷ)
+ * κ ۵Ǹ  ȣ  ġ ̾ 
+ *  Ʈ  ī Ӱ谪 ̸̻ overlapped  Ϸ  NETWORK_WOULD_BLOCK ȯ
+ * @param sock 
+ * @param queue ۽ ť
+ * @param on_sent   Ϸ ݹ (NULL )
+ * @param context ݹ鿡 ѱ 
+ * @return   NETWORK_SUCCESS, ۽ ۰    NETWORK_WOULD_BLOCK, Ǵ  ڵ
+ */
+network_result_t network_socket_flush_queue(network_socket_t* sock, network_send_queue_t* queue,
+    network_frame_sent_t on_sent, void* context);
+
 /**
  * ޽  (  а ̷ε ũ Ȯ  ü б)
  * @param sock 
@@ -282,6 +535,37 @@ int network_socket_has_data(network_socket_t* sock, int timeout_ms);
  */
 int network_socket_can_write(network_socket_t* sock, int timeout_ms);
 
+// =============================================================================
+// պ ð 
+// =============================================================================
+
+/**
+ * ƮƮ   ð (ũ, 32Ʈ ȯ)
+ * @return  ð (0 "" Ƿ ȯ )
+ */
+uint32_t network_rtt_timestamp(void);
+
+/**
+ * 밡  ðκ  ð
+ * @param timestamp network_rtt_timestamp  ð
+ * @return  ð (и)
+ */
+double network_rtt_elapsed_ms(uint32_t timestamp);
+
+/**
+ * RTT ǥ ݿ
+ * @param rtt  
+ * @param sample_ms  պ ð (и)
+ */
+void network_rtt_update(network_rtt_t* rtt, double sample_ms);
+
+/**
+ *  ŸӾƿ شϴ  (Ȱ RTT + 4 * )
+ * @param rtt  
+ * @return и (ǥ  0)
+ */
+double network_rtt_timeout_ms(const network_rtt_t* rtt);
+
 // =============================================================================
 // ƿƼ Լ
 // =============================================================================
@@ -13,6 +13,34 @@
 #define MAX_USERNAME_LENGTH     32          // ִ ڸ 
 #define MAX_CLIENTS             100         // ִ   
 #define SERVER_DEFAULT_PORT     8080        // ⺻  Ʈ
+#define SESSION_TOKEN_LENGTH    32          //  簳 ū  (null )
+#define CHAT_RECORD_HEADER_SIZE 6           // ä  ڵ  (ID 4Ʈ +  2Ʈ)
+#define COMPRESSED_FRAME_HEADER_SIZE 6      //   պκ ( Ÿ 2Ʈ +  ̷ε ũ 4Ʈ)
+
+//   ϴ   (connect/resume û capabilities, 信   ͸)
+#define PROTOCOL_CAP_COMPRESSION 0x00000001  //  -> Ŭ̾Ʈ   (MSG_COMPRESSED)
+#define PROTOCOL_CAP_COMPACT_HEADER 0x00000002 //       
+#define PROTOCOL_CAP_BATCH       0x00000004  //  -> Ŭ̾Ʈ   (MSG_BATCH)
+#define PROTOCOL_CAP_PRESENCE_DIGEST 0x00000008 // / MSG_USER_PRESENCE  
+
+// /   (ڸ ڸ   )
+#define PRESENCE_DIGEST_SEPARATOR   ','
+#define PRESENCE_DIGEST_JOINED      '+'
+#define PRESENCE_DIGEST_LEFT        '-'
+
+//  : [Ÿ ڵ 1Ʈ][÷ 1Ʈ][̷ε ũ varint 1~2Ʈ]
+//   Ŀ /     (޸  message_t   ״)
+#define COMPACT_HEADER_MIN_SIZE 3           // ̷ε 127Ʈ 
+#define COMPACT_HEADER_MAX_SIZE 4           // MAX_MESSAGE_SIZE (varint 2Ʈ)
+#define COMPACT_TYPE_CODE(type)     ((uint8_t)((((type) / 1000) << 4) | ((type) % 1000)))
+#define COMPACT_TYPE_FROM_CODE(code) ((uint16_t)(((code) >> 4) * 1000 + ((code) & 0x0F)))
+
+//   ÷
+#define FRAME_FLAG_COMPRESSED       0x01    // ̷ε尡  (MSG_COMPRESSED)
+#define FRAME_FLAG_BATCHED          0x02    //  ޽  
+#define FRAME_FLAG_PRIORITY_SHIFT   2       // 켱 (message_priority_t, 2Ʈ)
+#define FRAME_FLAG_PRIORITY_MASK    0x0C
+#define FRAME_FLAG_RESERVED_MASK    0xF0    // Ǿ  ߸ 
 
 // =============================================================================
 // ޽ Ÿ  (īװ з)
@@ -26,6 +54,10 @@ typedef enum {
     MSG_DISCONNECT = 1003,          // :  
     MSG_HEARTBEAT = 1004,           // :   Ȯ
     MSG_HEARTBEAT_ACK = 1005,       // : ƮƮ 
+    MSG_SESSION_TOKEN = 1006,       //  -> Ŭ̾Ʈ:  簳 ū ߱
+    MSG_SESSION_RESUME = 1007,      // Ŭ̾Ʈ -> :  簳 û (翬 )
+    MSG_COMPRESSED = 1008,          //  -> Ŭ̾Ʈ:   (   ޽ )
+    MSG_BATCH = 1009,               //  -> Ŭ̾Ʈ:  ޽   
 
     //  ޽ (2000)
     MSG_AUTH_BASE = 2000,
@@ -38,6 +70,7 @@ typedef enum {
     MSG_CHAT_SEND = 3001,           // Ŭ̾Ʈ -> : ä ޽
     MSG_CHAT_BROADCAST = 3002,      //  -> Ŭ̾Ʈ: εĳƮ
     MSG_CHAT_PRIVATE = 3003,        // :  ޽ ( Ȯ)
+    MSG_CHAT_SUBMIT = 3004,         // Ŭ̾Ʈ -> : ID  ä  (ߺ )
 
     //   (4000)
     MSG_USER_BASE = 4000,
@@ -45,6 +78,7 @@ typedef enum {
     MSG_USER_LIST_RESPONSE = 4002,  //  -> Ŭ̾Ʈ:   
     MSG_USER_JOINED = 4003,         //  -> Ŭ̾Ʈ:  
     MSG_USER_LEFT = 4004,           //  -> Ŭ̾Ʈ:  
+    MSG_USER_PRESENCE = 4005,       //  -> Ŭ̾Ʈ: /  ("+a,+b,-c")
 
     //  ޽ (9000)
     MSG_ERROR_BASE = 9000,
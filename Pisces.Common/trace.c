@@ -0,0 +1,178 @@
+#include "pch.h"
+#include "trace.h"
+#include "utils.h"
+#include <string.h>
+
+// =============================================================================
+//  
+// =============================================================================
+
+int g_trace_enabled = 0;
+
+static HANDLE g_trace_file = INVALID_HANDLE_VALUE;
+static HANDLE g_trace_mapping = NULL;
+static trace_file_header_t* g_trace_header = NULL;
+static trace_record_t* g_trace_records = NULL;
+static uint64_t g_trace_start_ticks = 0;
+
+// =============================================================================
+// Ʈ̽  /ݱ
+// =============================================================================
+
+int trace_open(const char* filename, uint32_t capacity) {
+    if (utils_string_is_empty(filename)) {
+        return -1;
+    }
+
+    if (g_trace_header) {
+        LOG_WARNING("Trace already open, closing previous trace");
+        trace_close();
+    }
+
+    if (capacity == 0) {
+        capacity = TRACE_DEFAULT_CAPACITY;
+    }
+    if (capacity < TRACE_MIN_CAPACITY) {
+        capacity = TRACE_MIN_CAPACITY;
+    }
+
+    uint64_t file_size = sizeof(trace_file_header_t) + (uint64_t)capacity * sizeof(trace_record_t);
+
+    g_trace_file = CreateFileA(filename, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ,
+        NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (g_trace_file == INVALID_HANDLE_VALUE) {
+        LOG_ERROR("Failed to create trace file %s (error %lu)", filename, GetLastError());
+        return -1;
+    }
+
+    //  ũ⸸ŭ   ( ڵ Ȯ)
+    g_trace_mapping = CreateFileMappingA(g_trace_file, NULL, PAGE_READWRITE,
+        (DWORD)(file_size >> 32), (DWORD)(file_size & 0xFFFFFFFF), NULL);
+    if (!g_trace_mapping) {
+        LOG_ERROR("Failed to create trace file mapping (error %lu)", GetLastError());
+        CloseHandle(g_trace_file);
+        g_trace_file = INVALID_HANDLE_VALUE;
+        return -1;
+    }
+
+    void* view = MapViewOfFile(g_trace_mapping, FILE_MAP_WRITE, 0, 0, (SIZE_T)file_size);
+    if (!view) {
+        LOG_ERROR("Failed to map trace file view (error %lu)", GetLastError());
+        CloseHandle(g_trace_mapping);
+        CloseHandle(g_trace_file);
+        g_trace_mapping = NULL;
+        g_trace_file = INVALID_HANDLE_VALUE;
+        return -1;
+    }
+
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    g_trace_start_ticks = (uint64_t)counter.QuadPart;
+
+    g_trace_header = (trace_file_header_t*)view;
+    g_trace_records = (trace_record_t*)((char*)view + sizeof(trace_file_header_t));
+
+    memset(g_trace_header, 0, sizeof(trace_file_header_t));
+    g_trace_header->magic = TRACE_FILE_MAGIC;
+    g_trace_header->version = TRACE_FILE_VERSION;
+    g_trace_header->record_size = (uint16_t)sizeof(trace_record_t);
+    g_trace_header->capacity = capacity;
+    g_trace_header->write_index = 0;
+    g_trace_header->start_time_ms = utils_get_current_timestamp_ms();
+    g_trace_header->ticks_per_second = (uint64_t)frequency.QuadPart;
+
+    g_trace_enabled = 1;
+
+    LOG_INFO("Binary trace enabled: %s (%u records)", filename, capacity);
+    return 0;
+}
+
+void trace_close(void) {
+    g_trace_enabled = 0;
+
+    if (g_trace_header) {
+        LOG_INFO("Binary trace closed (%llu events recorded)", g_trace_header->write_index);
+        FlushViewOfFile(g_trace_header, 0);
+        UnmapViewOfFile(g_trace_header);
+        g_trace_header = NULL;
+        g_trace_records = NULL;
+    }
+
+    if (g_trace_mapping) {
+        CloseHandle(g_trace_mapping);
+        g_trace_mapping = NULL;
+    }
+
+    if (g_trace_file != INVALID_HANDLE_VALUE) {
+        CloseHandle(g_trace_file);
+        g_trace_file = INVALID_HANDLE_VALUE;
+    }
+}
+
+// =============================================================================
+// ̺Ʈ 
+// =============================================================================
+
+void trace_record(trace_event_t event, uint32_t conn_id, uint16_t msg_type, uint32_t size) {
+    if (!g_trace_header) {
+        return;
+    }
+
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+
+    uint64_t index = g_trace_header->write_index;
+    trace_record_t* record = &g_trace_records[index % g_trace_header->capacity];
+
+    record->ticks = (uint64_t)counter.QuadPart - g_trace_start_ticks;
+    record->conn_id = conn_id;
+    record->event = (uint16_t)event;
+    record->msg_type = msg_type;
+    record->size = size;
+    record->reserved = 0;
+
+    // ڵ带   ڿ ε  (ڴ   ڵ带  ʵ)
+    g_trace_header->write_index = index + 1;
+}
+
+// =============================================================================
+// ƿƼ Լ
+// =============================================================================
+
+const char* trace_event_to_string(trace_event_t event) {
+    switch (event) {
+    case TRACE_EVENT_ACCEPT:         return "ACCEPT";
+    case TRACE_EVENT_FRAME_RECV:     return "FRAME_RECV";
+    case TRACE_EVENT_HANDLER_START:  return "HANDLER_START";
+    case TRACE_EVENT_HANDLER_END:    return "HANDLER_END";
+    case TRACE_EVENT_WRITE_QUEUED:   return "WRITE_QUEUED";
+    case TRACE_EVENT_WRITE_FLUSHED:  return "WRITE_FLUSHED";
+    case TRACE_EVENT_DISCONNECT:     return "DISCONNECT";
+    default:                         return "UNKNOWN";
+    }
+}
+
+int trace_validate_header(const trace_file_header_t* header) {
+    if (!header) {
+        return 0;
+    }
+
+    if (header->magic != TRACE_FILE_MAGIC) {
+        return 0;
+    }
+
+    if (header->version != TRACE_FILE_VERSION) {
+        return 0;
+    }
+
+    if (header->record_size != sizeof(trace_record_t) || header->capacity == 0) {
+        return 0;
+    }
+
+    if (header->ticks_per_second == 0) {
+        return 0;
+    }
+
+    return 1;
+}
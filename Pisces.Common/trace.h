@@ -0,0 +1,113 @@
+// trace.h
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "common_headers.h"
+#include <stdint.h>
+
+// =============================================================================
+// Ʈ̽  
+// =============================================================================
+
+#define TRACE_FILE_MAGIC            0x43525450  // "PTRC"
+#define TRACE_FILE_VERSION          1
+#define TRACE_DEFAULT_CAPACITY      65536       // ⺻ ڵ  ( 1.5MB)
+#define TRACE_MIN_CAPACITY          1024        // ּ ڵ 
+
+// Ʈ̽ ̺Ʈ 
+typedef enum {
+    TRACE_EVENT_NONE = 0,
+    TRACE_EVENT_ACCEPT = 1,             //  
+    TRACE_EVENT_FRAME_RECV = 2,         //   (type, size)
+    TRACE_EVENT_HANDLER_START = 3,      // ޽ ó  (type)
+    TRACE_EVENT_HANDLER_END = 4,        // ޽ ó  (type)
+    TRACE_EVENT_WRITE_QUEUED = 5,       // ۽ û (type, size)
+    TRACE_EVENT_WRITE_FLUSHED = 6,      // ۽ Ϸ (type, size)
+    TRACE_EVENT_DISCONNECT = 7,         //  
+    TRACE_EVENT_COUNT
+} trace_event_t;
+
+// =============================================================================
+// Ʈ̽   (ũ , Ʋ )
+// =============================================================================
+
+#pragma pack(push, 1)
+
+//   (40Ʈ)
+typedef struct {
+    uint32_t magic;                 // TRACE_FILE_MAGIC
+    uint16_t version;               // TRACE_FILE_VERSION
+    uint16_t record_size;           // sizeof(trace_record_t)
+    uint32_t capacity;              //   ڵ 
+    uint32_t reserved;
+    uint64_t write_index;           // ݱ ϵ  ڵ  (  ġ)
+    uint64_t start_time_ms;         // Ʈ̽  ð (epoch и)
+    uint64_t ticks_per_second;      // ڵ ticks  (QueryPerformanceFrequency)
+} trace_file_header_t;
+
+// ̺Ʈ ڵ (24Ʈ)
+typedef struct {
+    uint64_t ticks;                 // Ʈ̽    ticks
+    uint32_t conn_id;               // (Ŭ̾Ʈ) ID
+    uint16_t event;                 // trace_event_t
+    uint16_t msg_type;              // ޽ Ÿ (ش  0)
+    uint32_t size;                  // Ʈ  (ش  0)
+    uint32_t reserved;
+} trace_record_t;
+
+#pragma pack(pop)
+
+// =============================================================================
+// Ʈ̽  ũ
+// =============================================================================
+
+// Ʈ̽ Ȱȭ  ( )
+extern int g_trace_enabled;
+
+// Ȱ ÿ б ϳ  ζ ˻
+#define TRACE_EVENT(event, conn_id, msg_type, size) \
+    do { if (g_trace_enabled) trace_record(event, conn_id, msg_type, size); } while(0)
+
+// =============================================================================
+// Ʈ̽ Լ
+// =============================================================================
+
+/**
+ * Ʈ̽  ϰ ޸ Ͽ  
+ *   
+ * @param filename Ʈ̽  
+ * @param capacity   ڵ  (0̸ ⺻)
+ * @return   0,   -1
+ */
+int trace_open(const char* filename, uint32_t capacity);
+
+/**
+ * Ʈ̽      
+ */
+void trace_close(void);
+
+/**
+ * ̺Ʈ ڵ  (TRACE_EVENT ũθ  ȣ)
+ *  (  ) ȣϴ   
+ * @param event ̺Ʈ 
+ * @param conn_id  ID
+ * @param msg_type ޽ Ÿ
+ * @param size Ʈ 
+ */
+void trace_record(trace_event_t event, uint32_t conn_id, uint16_t msg_type, uint32_t size);
+
+/**
+ * Ʈ̽ ̺Ʈ ڿ ȯ
+ * @param event ̺Ʈ 
+ * @return ̺Ʈ ̸ ڿ
+ */
+const char* trace_event_to_string(trace_event_t event);
+
+/**
+ * Ʈ̽   ȿ ˻
+ * @param header ˻ 
+ * @return ȿϸ 1, ȿϸ 0
+ */
+int trace_validate_header(const trace_file_header_t* header);
+
+#endif // TRACE_H
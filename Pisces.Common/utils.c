@@ -5,6 +5,11 @@
 #include <stdarg.h>
 #include <ctype.h>
 #include <winsock2.h>
+#include <bcrypt.h>
+
+#ifdef _MSC_VER
+#pragma comment(lib, "bcrypt.lib")
+#endif
 
 // =============================================================================
 //  
@@ -12,6 +17,20 @@
 
 log_level_t g_current_log_level = LOG_LEVEL_INFO;
 
+log_level_t g_module_log_levels[LOG_MODULE_COUNT] = {
+    LOG_LEVEL_INFO, LOG_LEVEL_INFO, LOG_LEVEL_INFO, LOG_LEVEL_INFO, LOG_LEVEL_INFO
+};
+
+// ⺰   Ǿ 
+static int g_module_log_overridden[LOG_MODULE_COUNT] = { 0 };
+
+// 庰  ð (0̸    )
+static __declspec(thread) uint64_t t_loop_clock_ms = 0;
+
+// 庰 α ð ڿ (ʰ ٲ  ٽ )
+static __declspec(thread) time_t t_log_time_sec = 0;
+static __declspec(thread) char t_log_time_string[TIME_STRING_SIZE] = "";
+
 // =============================================================================
 // ð  Լ
 // =============================================================================
@@ -90,6 +109,22 @@ double utils_time_diff_seconds(time_t start, time_t end) {
     return difftime(end, start);
 }
 
+uint64_t utils_clock_update(void) {
+    t_loop_clock_ms = (uint64_t)GetTickCount64();
+    return t_loop_clock_ms;
+}
+
+uint64_t utils_clock_now_ms(void) {
+    if (t_loop_clock_ms == 0) {
+        return (uint64_t)GetTickCount64();  //    Ź 
+    }
+    return t_loop_clock_ms;
+}
+
+uint64_t utils_clock_elapsed_ms(uint64_t since, uint64_t now) {
+    return since > now ? 0 : now - since;
+}
+
 // =============================================================================
 // ڿ ƿƼ (ASCII )
 // =============================================================================
@@ -329,6 +364,44 @@ char* utils_generate_random_string(char* buffer, size_t length) {
     return buffer;
 }
 
+int utils_generate_secure_token(char* buffer, size_t length) {
+    if (!buffer || length == 0) {
+        return -1;
+    }
+
+    const char charset[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+    const size_t charset_size = sizeof(charset) - 1;
+
+    unsigned char random_bytes[256];
+    if (length > sizeof(random_bytes) ||
+        !BCRYPT_SUCCESS(BCryptGenRandom(NULL, random_bytes, (ULONG)length, BCRYPT_USE_SYSTEM_PREFERRED_RNG))) {
+        return -1;
+    }
+
+    for (size_t i = 0; i < length; i++) {
+        buffer[i] = charset[random_bytes[i] % charset_size];
+    }
+    buffer[length] = '\0';
+
+    SecureZeroMemory(random_bytes, sizeof(random_bytes));
+    return 0;
+}
+
+uint32_t utils_random_between(uint32_t low, uint32_t high) {
+    if (high <= low) {
+        return low;
+    }
+
+    //  ð  Ŭ̾Ʈ    ʵ rand()  OS  
+    uint32_t value;
+    if (!BCRYPT_SUCCESS(BCryptGenRandom(NULL, (unsigned char*)&value, sizeof(value), BCRYPT_USE_SYSTEM_PREFERRED_RNG))) {
+        value = (uint32_t)GetTickCount64() ^ (GetCurrentProcessId() << 16) ^ GetCurrentThreadId();
+    }
+
+    uint64_t span = (uint64_t)high - low + 1;
+    return low + (uint32_t)(value % span);
+}
+
 uint32_t utils_hash_string(const char* str) {
     if (!str) return 0;
 
@@ -347,14 +420,21 @@ uint32_t utils_hash_string(const char* str) {
 // α Լ
 // =============================================================================
 
-void utils_log(log_level_t level, const char* file, int line, const char* fmt, ...) {
-    if (level < g_current_log_level) {
-        return;  //  α    
+static const char* utils_log_time_string(void) {
+    //    α״   ڿ  (localtime_s/strftime ʴ  )
+    time_t now = time(NULL);
+    if (now != t_log_time_sec || t_log_time_string[0] == 0) {
+        if (!utils_time_to_string(now, t_log_time_string, sizeof(t_log_time_string))) {
+            t_log_time_string[0] = 0;
+        }
+        t_log_time_sec = now;
     }
+    return t_log_time_string;
+}
 
-    // ð ڿ 
-    char time_buffer[TIME_STRING_SIZE];
-    utils_get_current_time_string(time_buffer, sizeof(time_buffer));
+void utils_log(log_level_t level, const char* file, int line, const char* fmt, ...) {
+    // ð ڿ (庰 ĳ)
+    const char* time_buffer = utils_log_time_string();
 
     // ϸ   (ϸ ǥ)
     const char* filename = strrchr(file, '\\');
@@ -384,6 +464,99 @@ void utils_log(log_level_t level, const char* file, int line, const char* fmt, .
 
 void utils_set_log_level(log_level_t level) {
     g_current_log_level = level;
+
+    //       
+    for (int i = 0; i < LOG_MODULE_COUNT; i++) {
+        if (!g_module_log_overridden[i]) {
+            g_module_log_levels[i] = level;
+        }
+    }
+}
+
+void utils_set_module_log_level(log_module_t module, log_level_t level) {
+    if (module < 0 || module >= LOG_MODULE_COUNT) {
+        return;
+    }
+
+    g_module_log_levels[module] = level;
+    g_module_log_overridden[module] = 1;
+}
+
+void utils_reset_module_log_level(log_module_t module) {
+    if (module < 0 || module >= LOG_MODULE_COUNT) {
+        return;
+    }
+
+    g_module_log_levels[module] = g_current_log_level;
+    g_module_log_overridden[module] = 0;
+}
+
+static int utils_log_level_from_string(const char* str, log_level_t* level) {
+    if (_stricmp(str, "debug") == 0) *level = LOG_LEVEL_DEBUG;
+    else if (_stricmp(str, "info") == 0) *level = LOG_LEVEL_INFO;
+    else if (_stricmp(str, "warn") == 0 || _stricmp(str, "warning") == 0) *level = LOG_LEVEL_WARNING;
+    else if (_stricmp(str, "error") == 0) *level = LOG_LEVEL_ERROR;
+    else if (_stricmp(str, "crit") == 0 || _stricmp(str, "critical") == 0) *level = LOG_LEVEL_CRITICAL;
+    else return -1;
+
+    return 0;
+}
+
+int utils_parse_module_log_levels(const char* spec) {
+    if (utils_string_is_empty(spec)) {
+        return -1;
+    }
+
+    char buffer[256];
+    if (utils_string_copy(buffer, sizeof(buffer), spec) != 0) {
+        return -1;
+    }
+
+    char* context = NULL;
+    char* token = strtok_s(buffer, ",", &context);
+    while (token) {
+        char* separator = strchr(token, '=');
+        if (!separator) {
+            return -1;
+        }
+        *separator = '\0';
+
+        const char* module_name = utils_string_trim(token);
+        const char* level_name = utils_string_trim(separator + 1);
+
+        log_level_t level;
+        if (utils_log_level_from_string(level_name, &level) != 0) {
+            return -1;
+        }
+
+        int found = 0;
+        for (int i = 0; i < LOG_MODULE_COUNT; i++) {
+            if (_stricmp(module_name, utils_log_module_to_string((log_module_t)i)) == 0) {
+                utils_set_module_log_level((log_module_t)i, level);
+                found = 1;
+                break;
+            }
+        }
+
+        if (!found) {
+            return -1;
+        }
+
+        token = strtok_s(NULL, ",", &context);
+    }
+
+    return 0;
+}
+
+const char* utils_log_module_to_string(log_module_t module) {
+    switch (module) {
+    case LOG_MODULE_GENERAL: return "general";
+    case LOG_MODULE_NETWORK: return "network";
+    case LOG_MODULE_MESSAGE: return "message";
+    case LOG_MODULE_SERVER:  return "server";
+    case LOG_MODULE_CLIENT:  return "client";
+    default:                 return "unknown";
+    }
 }
 
 const char* utils_log_level_to_string(log_level_t level) {
@@ -17,23 +17,80 @@ typedef enum {
     LOG_LEVEL_CRITICAL = 4
 } log_level_t;
 
+// =============================================================================
+// α  
+// =============================================================================
+
+typedef enum {
+    LOG_MODULE_GENERAL = 0,     // з  ڵ (utils )
+    LOG_MODULE_NETWORK = 1,     // network.c
+    LOG_MODULE_MESSAGE = 2,     // message.c
+    LOG_MODULE_SERVER = 3,      // 
+    LOG_MODULE_CLIENT = 4,      // Ŭ̾Ʈ
+    LOG_MODULE_COUNT
+} log_module_t;
+
+//  ҽ  utils.h   LOG_MODULE Ͽ Ҽ  
+#ifndef LOG_MODULE
+#define LOG_MODULE LOG_MODULE_GENERAL
+#endif
+
 // =============================================================================
 // α ũ (ASCII )
 // =============================================================================
 
+//   ּ α  (̺   α״ ڵ忡  ŵ)
+// 0=DEBUG, 1=INFO, 2=WARNING, 3=ERROR, 4=CRITICAL
+#ifndef LOG_COMPILE_MIN_LEVEL
+#ifdef NDEBUG
+#define LOG_COMPILE_MIN_LEVEL   1
+#else
+#define LOG_COMPILE_MIN_LEVEL   0
+#endif
+#endif
+
 //  α  ( )
 extern log_level_t g_current_log_level;
 
+// ⺰ ȿ α  (   g_current_log_level )
+extern log_level_t g_module_log_levels[LOG_MODULE_COUNT];
+
+//  ⿡ ش  µǴ Ȯ (μ   ˻)
+#define LOG_ENABLED(level) ((level) >= g_module_log_levels[LOG_MODULE])
+
+//   ŵ α (μ 򰡵 ʰ ̻   )
+#define LOG_ELIDED(level, fmt, ...) \
+    do { if (0) utils_log(level, __FILE__, __LINE__, fmt, ##__VA_ARGS__); } while(0)
+
+#define LOG_AT(level, fmt, ...) \
+    do { if (LOG_ENABLED(level)) utils_log(level, __FILE__, __LINE__, fmt, ##__VA_ARGS__); } while(0)
+
 // α  ũε
-#define LOG_DEBUG(fmt, ...)    utils_log(LOG_LEVEL_DEBUG, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
-#define LOG_INFO(fmt, ...)     utils_log(LOG_LEVEL_INFO, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
-#define LOG_WARNING(fmt, ...)  utils_log(LOG_LEVEL_WARNING, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
-#define LOG_ERROR(fmt, ...)    utils_log(LOG_LEVEL_ERROR, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
-#define LOG_CRITICAL(fmt, ...) utils_log(LOG_LEVEL_CRITICAL, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
+#if LOG_COMPILE_MIN_LEVEL <= 0
+#define LOG_DEBUG(fmt, ...)    LOG_AT(LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
+#else
+#define LOG_DEBUG(fmt, ...)    LOG_ELIDED(LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
+#endif
+
+#if LOG_COMPILE_MIN_LEVEL <= 1
+#define LOG_INFO(fmt, ...)     LOG_AT(LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
+#else
+#define LOG_INFO(fmt, ...)     LOG_ELIDED(LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
+#endif
+
+#if LOG_COMPILE_MIN_LEVEL <= 2
+#define LOG_WARNING(fmt, ...)  LOG_AT(LOG_LEVEL_WARNING, fmt, ##__VA_ARGS__)
+#else
+#define LOG_WARNING(fmt, ...)  LOG_ELIDED(LOG_LEVEL_WARNING, fmt, ##__VA_ARGS__)
+#endif
+
+#define LOG_ERROR(fmt, ...)    LOG_AT(LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)
+#define LOG_CRITICAL(fmt, ...) LOG_AT(LOG_LEVEL_CRITICAL, fmt, ##__VA_ARGS__)
 
 // Ǻ α
 #define LOG_IF(condition, level, fmt, ...) \
-    do { if (condition) utils_log(level, __FILE__, __LINE__, fmt, ##__VA_ARGS__); } while(0)
+    do { if ((level) >= LOG_COMPILE_MIN_LEVEL && LOG_ENABLED(level) && (condition)) \
+        utils_log(level, __FILE__, __LINE__, fmt, ##__VA_ARGS__); } while(0)
 
 // =============================================================================
 // ð    Լ
@@ -82,6 +139,29 @@ uint64_t utils_get_current_timestamp_ms(void);
  */
 double utils_time_diff_seconds(time_t start, time_t end);
 
+/**
+ *    ð踦  (̺Ʈ  ݺ   ȣ)
+ *  ð(GetTickCount64) ̹Ƿ ý ð (NTP )   
+ * @return ŵ ð (и)
+ */
+uint64_t utils_clock_update(void);
+
+/**
+ *    ð  ( utils_clock_update ð)
+ * ŸӾƿ       (       ð)
+ * @return  ð (и)
+ */
+uint64_t utils_clock_now_ms(void);
+
+/**
+ * ٸ 尡 ڱ  ð  ð  ð
+ *   ð谡  ̸ֱ 0 (ȣ   ġ ʵ)
+ * @param since ϵ ð (utils_clock_now_ms )
+ * @param now   ð
+ * @return  ð (и)
+ */
+uint64_t utils_clock_elapsed_ms(uint64_t since, uint64_t now);
+
 // =============================================================================
 // ڿ ƿƼ (ASCII )
 // =============================================================================
@@ -214,6 +294,22 @@ const char* utils_winsock_error_to_string(int wsa_error);
  */
 char* utils_generate_random_string(char* buffer, size_t length);
 
+/**
+ *    ū  (ü ȣ , ASCII )
+ * @param buffer   (length + 1 Ʈ ̻)
+ * @param length  ū  (null )
+ * @return   0,   -1
+ */
+int utils_generate_secure_token(char* buffer, size_t length);
+
+/**
+ *     (μ ٸ ü  , õ Ϳ)
+ * @param low ּڰ
+ * @param high ִ (, low  low ȯ)
+ * @return low ̻ high  
+ */
+uint32_t utils_random_between(uint32_t low, uint32_t high);
+
 /**
  *  ؽ Լ (ڿ)
  * @param str ؽ ڿ
@@ -226,7 +322,7 @@ uint32_t utils_hash_string(const char* str);
 // =============================================================================
 
 /**
- * α  Լ (ũο ȣ)
+ * α  Լ (ũο ȣ,  ˻ ũο )
  * @param level α 
  * @param file ϸ
  * @param line  ȣ
@@ -241,6 +337,34 @@ void utils_log(log_level_t level, const char* file, int line, const char* fmt, .
  */
 void utils_set_log_level(log_level_t level);
 
+/**
+ * ⺰ α   ( α  켱)
+ * @param module  
+ * @param level  α 
+ */
+void utils_set_module_log_level(log_module_t module, log_level_t level);
+
+/**
+ * ⺰ α    ( α   )
+ * @param module  
+ */
+void utils_reset_module_log_level(log_module_t module);
+
+/**
+ * "module=level[,module=level...]"  ڿ ⺰ α  
+ * : "network=debug,server=warn"
+ * @param spec  ڿ
+ * @return   0,   -1
+ */
+int utils_parse_module_log_levels(const char* spec);
+
+/**
+ * α  ڿ ȯ
+ * @param module α 
+ * @return  ̸ ڿ
+ */
+const char* utils_log_module_to_string(log_module_t module);
+
 /**
  * α  ڿ ȯ
  * @param level α 
@@ -0,0 +1,535 @@
+#include "common_headers.h"
+#include "capture.h"
+#include "message.h"
+#include "network.h"
+#include "utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// =============================================================================
+// α׷ 
+// =============================================================================
+
+#define PROGRAM_NAME            "Traffic Replay"
+#define PROGRAM_VERSION         "1.0.0"
+
+#define DEFAULT_REPLAY_HOST     "127.0.0.1"
+#define DEFAULT_REPLAY_PORT     8080
+#define MAX_REPLAY_CONNECTIONS  256         // ÿ  ִ  
+#define MAX_PENDING_REQUESTS    64          //    û 
+#define REPLAY_DRAIN_TIMEOUT_MS 2000        //      ð
+
+// =============================================================================
+// ü 
+// =============================================================================
+
+typedef struct {
+    int show_help;              //  ǥ
+    int fast;                   //   ϰ ִ ӵ 
+    char host[MAX_HOSTNAME_LENGTH]; //   ȣƮ
+    uint16_t port;              //   Ʈ
+    const char* capture_file;   // ĸó  
+} replay_args_t;
+
+//  ٸ û
+typedef struct {
+    uint16_t expected_type;     // ϴ  Ÿ
+    uint64_t sent_us;           //  ð
+} pending_request_t;
+
+//   
+typedef struct {
+    uint32_t captured_id;       // ĸó   ID (0̸  )
+    network_socket_t* socket;   //  
+    uint32_t user_id;           //   Ҵ  ID
+
+    pending_request_t pending[MAX_PENDING_REQUESTS];
+    int pending_head;
+    int pending_count;
+} replay_conn_t;
+
+//   
+typedef struct {
+    uint32_t connections_opened;
+    uint32_t connections_failed;
+    uint64_t frames_sent;
+    uint64_t bytes_sent;
+    uint64_t frames_skipped;    //     
+    uint64_t frames_received;
+    uint64_t bytes_received;
+
+    uint32_t* latencies_us;     // û-  
+    size_t latency_count;
+    size_t latency_capacity;
+} replay_stats_t;
+
+// =============================================================================
+//  
+// =============================================================================
+
+static replay_conn_t g_connections[MAX_REPLAY_CONNECTIONS];
+static replay_stats_t g_stats;
+static uint64_t g_ticks_per_second = 0;
+
+// =============================================================================
+// Լ 
+// =============================================================================
+
+static void print_usage(const char* program_name);
+static int parse_arguments(int argc, char* argv[], replay_args_t* args);
+static uint64_t replay_now_us(void);
+static replay_conn_t* replay_find_connection(uint32_t captured_id);
+static void replay_open_connection(const replay_args_t* args, uint32_t captured_id);
+static void replay_close_connection(replay_conn_t* conn);
+static void replay_send_frame(replay_conn_t* conn, const char* frame, uint32_t length);
+static void replay_drain_responses(void);
+static void replay_add_latency(uint32_t latency_us);
+static void replay_print_report(const replay_args_t* args, uint64_t elapsed_us);
+static int compare_uint32(const void* a, const void* b);
+
+// =============================================================================
+//  Լ
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    replay_args_t args;
+    if (parse_arguments(argc, argv, &args) != 0) {
+        return EXIT_FAILURE;
+    }
+
+    if (args.show_help) {
+        print_usage(argv[0]);
+        return EXIT_SUCCESS;
+    }
+
+    capture_file_header_t header;
+    FILE* capture = capture_reader_open(args.capture_file, &header);
+    if (!capture) {
+        return EXIT_FAILURE;
+    }
+
+    if (network_initialize() != NETWORK_SUCCESS) {
+        LOG_ERROR("Failed to initialize network");
+        fclose(capture);
+        return EXIT_FAILURE;
+    }
+
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    g_ticks_per_second = (uint64_t)frequency.QuadPart;
+
+    memset(g_connections, 0, sizeof(g_connections));
+    memset(&g_stats, 0, sizeof(g_stats));
+
+    LOG_INFO("Replaying %s against %s:%d (%s)", args.capture_file, args.host, args.port,
+        args.fast ? "as fast as possible" : "original pacing");
+
+    char frame[MAX_MESSAGE_SIZE];
+    capture_record_t record;
+    uint64_t start_us = replay_now_us();
+    int read_result;
+
+    while ((read_result = capture_read_record(capture, &record, frame, sizeof(frame))) == 1) {
+        //   :  ð   
+        if (!args.fast) {
+            uint64_t target_us = start_us + record.timestamp_us;
+            uint64_t now_us;
+            while ((now_us = replay_now_us()) < target_us) {
+                replay_drain_responses();
+                if (target_us - now_us > 2000) {
+                    Sleep(1);
+                }
+            }
+        }
+
+        replay_conn_t* conn = replay_find_connection(record.conn_id);
+
+        switch (record.kind) {
+        case CAPTURE_RECORD_OPEN:
+            if (conn) {
+                replay_close_connection(conn);
+            }
+            replay_open_connection(&args, record.conn_id);
+            break;
+
+        case CAPTURE_RECORD_FRAME:
+            if (conn) {
+                replay_send_frame(conn, frame, record.length);
+            }
+            else {
+                g_stats.frames_skipped++;
+            }
+            break;
+
+        case CAPTURE_RECORD_CLOSE:
+            if (conn) {
+                replay_close_connection(conn);
+            }
+            break;
+
+        default:
+            LOG_WARNING("Unknown capture record kind %d", record.kind);
+            break;
+        }
+
+        replay_drain_responses();
+    }
+
+    if (read_result < 0) {
+        LOG_WARNING("Capture file read error, replay stopped early");
+    }
+
+    //   
+    uint64_t drain_deadline = replay_now_us() + (uint64_t)REPLAY_DRAIN_TIMEOUT_MS * 1000;
+    while (replay_now_us() < drain_deadline) {
+        int outstanding = 0;
+        for (int i = 0; i < MAX_REPLAY_CONNECTIONS; i++) {
+            outstanding += g_connections[i].captured_id != 0 ? g_connections[i].pending_count : 0;
+        }
+        if (outstanding == 0) {
+            break;
+        }
+        replay_drain_responses();
+        Sleep(1);
+    }
+
+    uint64_t elapsed_us = replay_now_us() - start_us;
+
+    for (int i = 0; i < MAX_REPLAY_CONNECTIONS; i++) {
+        if (g_connections[i].captured_id != 0) {
+            replay_close_connection(&g_connections[i]);
+        }
+    }
+
+    fclose(capture);
+    network_cleanup();
+
+    replay_print_report(&args, elapsed_us);
+    free(g_stats.latencies_us);
+
+    return EXIT_SUCCESS;
+}
+
+// =============================================================================
+//   μ Ľ
+// =============================================================================
+
+static void print_usage(const char* program_name) {
+    printf("%s v%s\n\n", PROGRAM_NAME, PROGRAM_VERSION);
+    printf("Usage: %s [OPTIONS] <capture-file>\n\n", program_name);
+    printf("Replays traffic recorded with 'server --capture <file>' against a server.\n\n");
+
+    printf("OPTIONS:\n");
+    printf("  -s, --server <host>     Target server host (default: %s)\n", DEFAULT_REPLAY_HOST);
+    printf("  -p, --port <port>       Target server port (default: %d)\n", DEFAULT_REPLAY_PORT);
+    printf("  -f, --fast              Ignore recorded pacing, send as fast as possible\n");
+    printf("  -h, --help              Show this help message\n");
+}
+
+static int parse_arguments(int argc, char* argv[], replay_args_t* args) {
+    args->show_help = 0;
+    args->fast = 0;
+    utils_string_copy(args->host, sizeof(args->host), DEFAULT_REPLAY_HOST);
+    args->port = DEFAULT_REPLAY_PORT;
+    args->capture_file = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+
+        if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
+            args->show_help = 1;
+            return 0;
+        }
+        else if (strcmp(arg, "-f") == 0 || strcmp(arg, "--fast") == 0) {
+            args->fast = 1;
+        }
+        else if (strcmp(arg, "-s") == 0 || strcmp(arg, "--server") == 0) {
+            if (i + 1 >= argc) {
+                LOG_ERROR("Option %s requires a hostname", arg);
+                return -1;
+            }
+            utils_string_copy(args->host, sizeof(args->host), argv[++i]);
+        }
+        else if (strcmp(arg, "-p") == 0 || strcmp(arg, "--port") == 0) {
+            if (i + 1 >= argc) {
+                LOG_ERROR("Option %s requires a port number", arg);
+                return -1;
+            }
+            int port = atoi(argv[++i]);
+            if (port <= 0 || port > 65535) {
+                LOG_ERROR("Invalid port number: %d (must be 1-65535)", port);
+                return -1;
+            }
+            args->port = (uint16_t)port;
+        }
+        else if (arg[0] == '-') {
+            LOG_ERROR("Unknown option: %s", arg);
+            LOG_ERROR("Use -h or --help for usage information");
+            return -1;
+        }
+        else {
+            args->capture_file = arg;
+        }
+    }
+
+    if (!args->capture_file) {
+        LOG_ERROR("No capture file specified");
+        LOG_ERROR("Use -h or --help for usage information");
+        return -1;
+    }
+
+    return 0;
+}
+
+// =============================================================================
+//  
+// =============================================================================
+
+static uint64_t replay_now_us(void) {
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    uint64_t ticks = (uint64_t)counter.QuadPart;
+    return ticks / g_ticks_per_second * 1000000 +
+        ticks % g_ticks_per_second * 1000000 / g_ticks_per_second;
+}
+
+static replay_conn_t* replay_find_connection(uint32_t captured_id) {
+    if (captured_id == 0) {
+        return NULL;
+    }
+
+    for (int i = 0; i < MAX_REPLAY_CONNECTIONS; i++) {
+        if (g_connections[i].captured_id == captured_id) {
+            return &g_connections[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void replay_open_connection(const replay_args_t* args, uint32_t captured_id) {
+    replay_conn_t* conn = NULL;
+    for (int i = 0; i < MAX_REPLAY_CONNECTIONS && !conn; i++) {
+        if (g_connections[i].captured_id == 0) {
+            conn = &g_connections[i];
+        }
+    }
+
+    if (!conn) {
+        LOG_WARNING("Too many concurrent connections, skipping connection %u", captured_id);
+        g_stats.connections_failed++;
+        return;
+    }
+
+    network_socket_t* socket = network_socket_create(SOCKET_TYPE_TCP_CLIENT);
+    if (!socket) {
+        g_stats.connections_failed++;
+        return;
+    }
+
+    // ŷ      ŷ ȯ
+    if (network_socket_connect(socket, args->host, args->port) != NETWORK_SUCCESS ||
+        network_socket_set_nonblocking(socket) != NETWORK_SUCCESS) {
+        LOG_WARNING("Failed to open replay connection %u", captured_id);
+        network_socket_destroy(socket);
+        g_stats.connections_failed++;
+        return;
+    }
+
+    // ĸó  û  û  Ƿ  ӵ Ǯ  ְ غ
+    network_socket_enable_compression(socket);
+
+    memset(conn, 0, sizeof(replay_conn_t));
+    conn->captured_id = captured_id;
+    conn->socket = socket;
+    g_stats.connections_opened++;
+
+    LOG_DEBUG("Opened replay connection for captured client %u", captured_id);
+}
+
+static void replay_close_connection(replay_conn_t* conn) {
+    if (conn->socket) {
+        network_socket_close(conn->socket);
+        network_socket_destroy(conn->socket);
+    }
+
+    memset(conn, 0, sizeof(replay_conn_t));
+}
+
+// =============================================================================
+// ۼ   
+// =============================================================================
+
+static void replay_send_frame(replay_conn_t* conn, const char* frame, uint32_t length) {
+    if (length < sizeof(message_header_t)) {
+        return;
+    }
+
+    message_header_t header;
+    memcpy(&header, frame, sizeof(header));
+    uint16_t msg_type = ntohs(header.type);
+
+    // ĸó Ʈ ״   ϳ  Ƿ    û 
+    char patched[MAX_MESSAGE_SIZE];
+    uint32_t* capabilities = NULL;
+    if (length <= sizeof(patched)) {
+        if (msg_type == MSG_CONNECT_REQUEST && length >= sizeof(header) + sizeof(connect_request_payload_t)) {
+            memcpy(patched, frame, length);
+            capabilities = &((connect_request_payload_t*)(patched + sizeof(header)))->capabilities;
+        }
+        else if (msg_type == MSG_SESSION_RESUME && length >= sizeof(header) + sizeof(session_resume_payload_t)) {
+            memcpy(patched, frame, length);
+            capabilities = &((session_resume_payload_t*)(patched + sizeof(header)))->capabilities;
+        }
+    }
+    if (capabilities) {
+        *capabilities = htonl(ntohl(*capabilities) & ~(PROTOCOL_CAP_COMPACT_HEADER | PROTOCOL_CAP_BATCH));
+        frame = patched;
+    }
+
+    // ۽ڿ  ƿ  ִ û   
+    uint16_t expected_type = 0;
+    switch (msg_type) {
+    case MSG_CONNECT_REQUEST:   expected_type = MSG_CONNECT_RESPONSE; break;
+    case MSG_USER_LIST_REQUEST: expected_type = MSG_USER_LIST_RESPONSE; break;
+    case MSG_CHAT_SEND:         expected_type = MSG_CHAT_BROADCAST; break;
+    case MSG_CHAT_SUBMIT:       expected_type = MSG_CHAT_BROADCAST; break;
+    default:                    break;
+    }
+
+    uint64_t sent_us = replay_now_us();
+    network_result_t result = network_socket_send_all(conn->socket, frame, (int)length);
+    if (result != NETWORK_SUCCESS) {
+        LOG_WARNING("Send failed on replay connection %u: %s",
+            conn->captured_id, network_result_to_string(result));
+        replay_close_connection(conn);
+        return;
+    }
+
+    g_stats.frames_sent++;
+    g_stats.bytes_sent += length;
+
+    if (expected_type != 0 && conn->pending_count < MAX_PENDING_REQUESTS) {
+        int tail = (conn->pending_head + conn->pending_count) % MAX_PENDING_REQUESTS;
+        conn->pending[tail].expected_type = expected_type;
+        conn->pending[tail].sent_us = sent_us;
+        conn->pending_count++;
+    }
+}
+
+static void replay_drain_responses(void) {
+    for (int i = 0; i < MAX_REPLAY_CONNECTIONS; i++) {
+        replay_conn_t* conn = &g_connections[i];
+        if (conn->captured_id == 0 || !conn->socket) {
+            continue;
+        }
+
+        while (network_socket_has_data(conn->socket, 0) > 0) {
+            message_t* msg = network_socket_recv_message(conn->socket);
+            if (!msg) {
+                if (!network_socket_is_connected(conn->socket)) {
+                    LOG_DEBUG("Replay connection %u closed by server", conn->captured_id);
+                    replay_close_connection(conn);
+                }
+                break;
+            }
+
+            uint64_t now_us = replay_now_us();
+            uint16_t msg_type = ntohs(msg->header.type);
+            g_stats.frames_received++;
+            g_stats.bytes_received += message_get_total_size(msg);
+
+            if (msg_type == MSG_CONNECT_RESPONSE &&
+                ntohl(msg->header.payload_size) >= sizeof(connect_response_payload_t)) {
+                const connect_response_payload_t* response = (const connect_response_payload_t*)msg->payload;
+                conn->user_id = ntohl(response->user_id);
+            }
+
+            // ä   εĳƮ  
+            int is_own_echo = 1;
+            if (msg_type == MSG_CHAT_BROADCAST) {
+                is_own_echo = ntohl(msg->header.payload_size) >= sizeof(uint32_t) &&
+                    ntohl(*(const uint32_t*)msg->payload) == conn->user_id;
+            }
+
+            if (conn->pending_count > 0) {
+                pending_request_t* pending = &conn->pending[conn->pending_head];
+                int matches = (pending->expected_type == msg_type && is_own_echo) ||
+                    (pending->expected_type == MSG_CONNECT_RESPONSE && IS_ERROR_MSG(msg_type));
+
+                if (matches) {
+                    replay_add_latency((uint32_t)(now_us - pending->sent_us));
+                    conn->pending_head = (conn->pending_head + 1) % MAX_PENDING_REQUESTS;
+                    conn->pending_count--;
+                }
+            }
+
+            message_destroy(msg);
+        }
+    }
+}
+
+static void replay_add_latency(uint32_t latency_us) {
+    if (g_stats.latency_count == g_stats.latency_capacity) {
+        size_t new_capacity = g_stats.latency_capacity ? g_stats.latency_capacity * 2 : 1024;
+        uint32_t* samples = (uint32_t*)realloc(g_stats.latencies_us, new_capacity * sizeof(uint32_t));
+        if (!samples) {
+            return;
+        }
+        g_stats.latencies_us = samples;
+        g_stats.latency_capacity = new_capacity;
+    }
+
+    g_stats.latencies_us[g_stats.latency_count++] = latency_us;
+}
+
+// =============================================================================
+//  
+// =============================================================================
+
+static int compare_uint32(const void* a, const void* b) {
+    uint32_t left = *(const uint32_t*)a;
+    uint32_t right = *(const uint32_t*)b;
+    return (left > right) - (left < right);
+}
+
+static void replay_print_report(const replay_args_t* args, uint64_t elapsed_us) {
+    double elapsed_sec = elapsed_us / 1000000.0;
+    char sent_str[32], received_str[32];
+    utils_bytes_to_human_readable(g_stats.bytes_sent, sent_str, sizeof(sent_str));
+    utils_bytes_to_human_readable(g_stats.bytes_received, received_str, sizeof(received_str));
+
+    printf("\n=== Replay Report ===\n");
+    printf("Capture: %s\n", args->capture_file);
+    printf("Target: %s:%d (%s)\n", args->host, args->port, args->fast ? "fast" : "paced");
+    printf("Elapsed: %.3f seconds\n", elapsed_sec);
+    printf("Connections: %u opened, %u failed\n", g_stats.connections_opened, g_stats.connections_failed);
+    printf("Frames sent: %llu (%s), skipped: %llu\n", g_stats.frames_sent, sent_str, g_stats.frames_skipped);
+    printf("Frames received: %llu (%s)\n", g_stats.frames_received, received_str);
+    if (elapsed_sec > 0.0) {
+        printf("Throughput: %.1f frames/s sent, %.1f frames/s received\n",
+            g_stats.frames_sent / elapsed_sec, g_stats.frames_received / elapsed_sec);
+    }
+
+    if (g_stats.latency_count == 0) {
+        printf("Latency: no request/response pairs measured\n");
+        return;
+    }
+
+    qsort(g_stats.latencies_us, g_stats.latency_count, sizeof(uint32_t), compare_uint32);
+
+    uint64_t total_us = 0;
+    for (size_t i = 0; i < g_stats.latency_count; i++) {
+        total_us += g_stats.latencies_us[i];
+    }
+
+    size_t count = g_stats.latency_count;
+    printf("Latency (%zu samples): min %u us, avg %llu us, p50 %u us, p99 %u us, max %u us\n",
+        count,
+        g_stats.latencies_us[0],
+        total_us / count,
+        g_stats.latencies_us[count / 2],
+        g_stats.latencies_us[(count * 99) / 100],
+        g_stats.latencies_us[count - 1]);
+}
@@ -1,4 +1,6 @@
-﻿#include "server.h"
+﻿#define LOG_MODULE LOG_MODULE_SERVER
+
+#include "server.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -25,6 +27,16 @@ typedef struct {
     int verbose;                // 상세 로그 레벨
     int daemon_mode;            // 데몬 모드 (추후 구현)
     char config_file[256];      // 설정 파일 경로
+    char trace_file[MAX_PATH];  // 바이너리 트레이스 파일 경로
+    char capture_file[MAX_PATH]; // 트래픽 캡처 파일 경로
+    int resume_grace_sec;       // 세션 재개 유예 시간 (-1이면 기본값 사용)
+    int listen_backlog;         // 리스닝 대기열 크기 (0이면 기본값 사용)
+    int tcp_nodelay;            // TCP_NODELAY (-1이면 기본값 사용)
+    int batch_writes;           // 루프 끝 모아 보내기 (-1이면 기본값 사용)
+    long zerocopy_threshold;    // 제로 카피 임계값 바이트 (-1이면 기본값 사용)
+    int enable_compression;     // 프레임 압축 허용 (-1이면 기본값 사용)
+    int enable_compact_header;  // 압축 헤더 허용 (-1이면 기본값 사용)
+    long presence_window_ms;    // 입장/퇴장 요약 간격 (-1이면 기본값 사용)
 } command_args_t;
 
 // =============================================================================
@@ -98,6 +110,8 @@ int main(int argc, char* argv[]) {
     LOG_INFO("Port: %d", config.port);
     LOG_INFO("Max clients: %d", config.max_clients);
     LOG_INFO("Heartbeat: %s", config.enable_heartbeat ? "Enabled" : "Disabled");
+    LOG_INFO("Writes: %s, %s", config.batch_writes ? "batched per loop" : "immediate",
+        config.tcp_nodelay ? "TCP_NODELAY" : "Nagle");
     LOG_INFO("=================================================");
     LOG_INFO("Press Ctrl+C to stop the server");
     LOG_INFO("");
@@ -132,7 +146,22 @@ static void print_usage(const char* program_name) {
         MAX_SERVER_CLIENTS, MAX_SERVER_CLIENTS);
     printf("  -v, --verbose           Enable verbose logging (DEBUG level)\n");
     printf("  -q, --quiet             Quiet mode (ERROR level only)\n");
+    printf("      --log-module <spec> Per-module log level (e.g. network=debug,server=warn)\n");
     printf("  -c, --config <file>     Load configuration from file\n");
+    printf("  -t, --trace <file>      Record binary event trace to file (see tracedump)\n");
+    printf("      --capture <file>    Record inbound traffic for replay (see replay)\n");
+    printf("      --resume-grace <sec> Seconds a dropped session can resume (default: %d, 0: off)\n",
+        SERVER_RESUME_GRACE_SEC);
+    printf("      --backlog <num>     Pending connection queue size (default: %d, max: %d)\n",
+        SERVER_LISTEN_BACKLOG, NETWORK_LISTEN_BACKLOG_MAX);
+    printf("      --nagle             Leave Nagle's algorithm on (default: TCP_NODELAY)\n");
+    printf("      --no-batch          Send every frame immediately instead of once per loop\n");
+    printf("      --zerocopy <bytes>  Send flushes of at least <bytes> without copying (default: off)\n");
+    printf("                          (sets SO_SNDBUF=0, which applies to every send on the connection)\n");
+    printf("      --no-compression    Refuse frame compression requested by clients\n");
+    printf("      --no-compact        Keep the full 12-byte frame header after login\n");
+    printf("      --presence-window <ms> Coalesce joins/leaves into one digest per window (default: %d, 0: off)\n",
+        SERVER_PRESENCE_WINDOW_MS);
     printf("  -h, --help              Show this help message\n");
     printf("      --version           Show version information\n");
     printf("\n");
@@ -185,6 +214,16 @@ static int parse_arguments(int argc, char* argv[], command_args_t* args) {
     args->verbose = 0;
     args->daemon_mode = 0;
     args->config_file[0] = '\0';
+    args->trace_file[0] = '\0';
+    args->capture_file[0] = '\0';
+    args->resume_grace_sec = -1;  // -1이면 기본값 사용
+    args->listen_backlog = 0;
+    args->tcp_nodelay = -1;
+    args->batch_writes = -1;
+    args->zerocopy_threshold = -1;
+    args->enable_compression = -1;
+    args->enable_compact_header = -1;
+    args->presence_window_ms = -1;
 
     for (int i = 1; i < argc; i++) {
         const char* arg = argv[i];
@@ -249,6 +288,20 @@ static int parse_arguments(int argc, char* argv[], command_args_t* args) {
             args->verbose = -1;  // 조용한 모드 표시
         }
 
+        // 모듈별 로그 레벨
+        else if (strcmp(arg, "--log-module") == 0) {
+            if (i + 1 >= argc) {
+                LOG_ERROR("Option %s requires a module=level list", arg);
+                return -1;
+            }
+
+            if (utils_parse_module_log_levels(argv[++i]) != 0) {
+                LOG_ERROR("Invalid module log level spec: %s", argv[i]);
+                LOG_ERROR("Modules: general, network, message, server, client / Levels: debug, info, warn, error, crit");
+                return -1;
+            }
+        }
+
         // 설정 파일
         else if (strcmp(arg, "-c") == 0 || strcmp(arg, "--config") == 0) {
             if (i + 1 >= argc) {
@@ -259,6 +312,102 @@ static int parse_arguments(int argc, char* argv[], command_args_t* args) {
             utils_string_copy(args->config_file, sizeof(args->config_file), argv[++i]);
         }
 
+        // 바이너리 트레이스
+        else if (strcmp(arg, "-t") == 0 || strcmp(arg, "--trace") == 0) {
+            if (i + 1 >= argc) {
+                LOG_ERROR("Option %s requires a file path", arg);
+                return -1;
+            }
+
+            utils_string_copy(args->trace_file, sizeof(args->trace_file), argv[++i]);
+        }
+
+        // 트래픽 캡처
+        else if (strcmp(arg, "--capture") == 0) {
+            if (i + 1 >= argc) {
+                LOG_ERROR("Option %s requires a file path", arg);
+                return -1;
+            }
+
+            utils_string_copy(args->capture_file, sizeof(args->capture_file), argv[++i]);
+        }
+
+        // 세션 재개 유예 시간
+        else if (strcmp(arg, "--resume-grace") == 0) {
+            if (i + 1 >= argc) {
+                LOG_ERROR("Option %s requires a number of seconds", arg);
+                return -1;
+            }
+
+            args->resume_grace_sec = atoi(argv[++i]);
+            if (args->resume_grace_sec < 0) {
+                LOG_ERROR("Invalid resume grace: %s", argv[i]);
+                return -1;
+            }
+        }
+
+        // 리스닝 대기열 크기
+        else if (strcmp(arg, "--backlog") == 0) {
+            if (i + 1 >= argc) {
+                LOG_ERROR("Option %s requires a number", arg);
+                return -1;
+            }
+
+            args->listen_backlog = atoi(argv[++i]);
+            if (args->listen_backlog < 1 || args->listen_backlog > NETWORK_LISTEN_BACKLOG_MAX) {
+                LOG_ERROR("Invalid backlog: %s (must be 1-%d)", argv[i], NETWORK_LISTEN_BACKLOG_MAX);
+                return -1;
+            }
+        }
+
+        // Nagle 알고리즘 사용 (TCP_NODELAY 끄기)
+        else if (strcmp(arg, "--nagle") == 0) {
+            args->tcp_nodelay = 0;
+        }
+
+        // 프레임마다 즉시 전송 (루프 끝 모아 보내기 끄기)
+        else if (strcmp(arg, "--no-batch") == 0) {
+            args->batch_writes = 0;
+        }
+
+        // 제로 카피 전송 임계값
+        else if (strcmp(arg, "--zerocopy") == 0) {
+            if (i + 1 >= argc) {
+                LOG_ERROR("Option %s requires a number of bytes", arg);
+                return -1;
+            }
+
+            args->zerocopy_threshold = atol(argv[++i]);
+            if (args->zerocopy_threshold < 0) {
+                LOG_ERROR("Invalid zero-copy threshold: %s", argv[i]);
+                return -1;
+            }
+        }
+
+        // 프레임 압축 거부
+        else if (strcmp(arg, "--no-compression") == 0) {
+            args->enable_compression = 0;
+        }
+
+        // 압축 헤더 거부
+        else if (strcmp(arg, "--no-compact") == 0) {
+            args->enable_compact_header = 0;
+        }
+
+        // 입장/퇴장 요약 간격
+        else if (strcmp(arg, "--presence-window") == 0) {
+            if (i + 1 >= argc) {
+                LOG_ERROR("Option %s requires a number of milliseconds", arg);
+                return -1;
+            }
+
+            args->presence_window_ms = atol(argv[++i]);
+            if (args->presence_window_ms < 0 || args->presence_window_ms > 60000) {
+                LOG_ERROR("Invalid presence window: %s (must be 0-60000)", argv[i]);
+                return -1;
+            }
+        }
+
         // 알 수 없는 옵션
         else {
             LOG_ERROR("Unknown option: %s", arg);
@@ -301,6 +450,46 @@ static server_config_t create_server_config_from_args(const command_args_t* args
         config.max_clients = args->max_clients;
     }
 
+    if (args->trace_file[0] != '\0') {
+        utils_string_copy(config.trace_file, sizeof(config.trace_file), args->trace_file);
+    }
+
+    if (args->capture_file[0] != '\0') {
+        utils_string_copy(config.capture_file, sizeof(config.capture_file), args->capture_file);
+    }
+
+    if (args->resume_grace_sec != -1) {
+        config.resume_grace_sec = args->resume_grace_sec;
+    }
+
+    if (args->listen_backlog > 0) {
+        config.listen_backlog = args->listen_backlog;
+    }
+
+    if (args->tcp_nodelay != -1) {
+        config.tcp_nodelay = args->tcp_nodelay;
+    }
+
+    if (args->batch_writes != -1) {
+        config.batch_writes = args->batch_writes;
+    }
+
+    if (args->zerocopy_threshold != -1) {
+        config.zerocopy_threshold = (uint32_t)args->zerocopy_threshold;
+    }
+
+    if (args->enable_compression != -1) {
+        config.enable_compression = args->enable_compression;
+    }
+
+    if (args->enable_compact_header != -1) {
+        config.enable_compact_header = args->enable_compact_header;
+    }
+
+    if (args->presence_window_ms != -1) {
+        config.presence_window_ms = (uint32_t)args->presence_window_ms;
+    }
+
     // 로그 레벨 설정
     if (args->verbose == 1) {
         config.log_level = LOG_LEVEL_DEBUG;
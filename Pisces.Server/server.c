@@ -1,3 +1,5 @@
+#define LOG_MODULE LOG_MODULE_SERVER
+
 #include "server.h"
 #include <stdlib.h>
 #include <string.h>
@@ -10,13 +12,47 @@
 static chat_server_t* g_server_instance = NULL;
 
 static void server_handle_new_connection(chat_server_t* server);
+static void server_reject_connection(chat_server_t* server, network_socket_t* temp_socket);
+static void server_admit_connection(chat_server_t* server, network_socket_t* client_socket);
 static void server_handle_client_data(chat_server_t* server);
 static void server_process_client_message(chat_server_t* server, client_info_t* client, message_t* message);
 static void server_handle_connect_request(chat_server_t* server, client_info_t* client, message_t* message);
 static void server_handle_chat_message(chat_server_t* server, client_info_t* client, message_t* message);
+static void server_handle_chat_submit(chat_server_t* server, client_info_t* client, message_t* message);
+static int server_require_authentication(chat_server_t* server, client_info_t* client);
+static void server_publish_user_chat(chat_server_t* server, client_info_t* client, const char* text,
+    uint32_t length, uint32_t message_id);
 static void server_handle_user_list_request(chat_server_t* server, client_info_t* client, message_t* message);
 static void server_handle_heartbeat_ack(chat_server_t* server, client_info_t* client, message_t* message);
 static void server_handle_disconnect_request(chat_server_t* server, client_info_t* client, message_t* message);
+static void server_handle_session_resume(chat_server_t* server, client_info_t* client, message_t* message);
+static int server_validate_username(chat_server_t* server, client_info_t* client, const char* username);
+static void server_complete_login(chat_server_t* server, client_info_t* client, const char* username, int resumed,
+    uint32_t requested_capabilities);
+static void server_announce_presence(chat_server_t* server, const char* username, int joined, uint32_t exclude_client_id);
+static void server_flush_presence(chat_server_t* server, int force);
+static int server_format_presence_notice(const server_room_t* room, const char* exclude_username,
+    char* buffer, size_t buffer_size);
+static int server_presence_has_change(const server_room_t* room, const char* username);
+static void server_schedule_heartbeat(chat_server_t* server, client_info_t* client, uint64_t from_ms);
+static double server_queue_wait_ms(const chat_server_t* server, const client_info_t* client);
+static double server_drain_budget_ms(const client_info_t* client);
+static void server_issue_session_token(chat_server_t* server, client_info_t* client);
+static void server_send_session_token(chat_server_t* server, client_info_t* client);
+static int server_detach_session(chat_server_t* server, client_info_t* client);
+static void server_release_detached_username(chat_server_t* server, const char* username);
+static int server_expire_detached_sessions(chat_server_t* server, uint64_t now_ms);
+static int server_replay_backlog(chat_server_t* server, client_info_t* client, uint32_t last_sequence);
+static int server_queue_frame(chat_server_t* server, client_info_t* client, network_frame_t* frame);
+static int server_push_frame(chat_server_t* server, client_info_t* client, network_frame_t* frame);
+static void server_seal_batch(chat_server_t* server, client_info_t* client);
+static void server_discard_batch(client_info_t* client);
+static network_frame_t* server_build_batch(chat_server_t* server, client_info_t* client);
+static void server_clear_batch_cache(chat_server_t* server);
+static int server_broadcast_frame(chat_server_t* server, network_frame_t* frame, uint32_t exclude_client_id, int authenticated_only);
+static network_frame_t* server_record_chat(chat_server_t* server, message_t* message);
+static network_result_t server_flush_client(chat_server_t* server, client_info_t* client);
+static void server_on_frame_flushed(const network_frame_t* frame, void* context);
 
 // =============================================================================
 //  Ŭ Լ
@@ -33,6 +69,18 @@ server_config_t server_get_default_config(void) {
     config.client_timeout_sec = CLIENT_TIMEOUT_SEC;
     config.log_level = LOG_LEVEL_INFO;
     config.enable_heartbeat = 1;  // ƮƮ ⺻ Ȱȭ
+    utils_string_copy(config.trace_file, sizeof(config.trace_file), "");  // Ʈ̽ Ȱȭ
+    config.trace_capacity = TRACE_DEFAULT_CAPACITY;
+    utils_string_copy(config.capture_file, sizeof(config.capture_file), "");  // ĸó Ȱȭ
+    config.resume_grace_sec = SERVER_RESUME_GRACE_SEC;
+    config.listen_backlog = SERVER_LISTEN_BACKLOG;
+    config.tcp_nodelay = 1;   //    Ƿ Nagle  ٸ  
+    config.batch_writes = 1;
+    config.zerocopy_threshold = 0;  //  ī Ȱȭ
+    config.enable_compression = 1;
+    config.compression_threshold = SERVER_COMPRESSION_THRESHOLD;
+    config.enable_compact_header = 1;
+    config.presence_window_ms = SERVER_PRESENCE_WINDOW_MS;
 
     return config;
 }
@@ -69,6 +117,17 @@ int server_validate_config(const server_config_t* config) {
         return 0;
     }
 
+    if (config->listen_backlog < 1 || config->listen_backlog > NETWORK_LISTEN_BACKLOG_MAX) {
+        LOG_ERROR("Invalid listen_backlog: %d (must be 1-%d)",
+            config->listen_backlog, NETWORK_LISTEN_BACKLOG_MAX);
+        return 0;
+    }
+
+    if (config->resume_grace_sec < 0) {
+        LOG_ERROR("Invalid resume_grace_sec: %d (must be >= 0)", config->resume_grace_sec);
+        return 0;
+    }
+
     if (config->enable_heartbeat && config->heartbeat_interval_sec < 10) {
         LOG_ERROR("Invalid heartbeat_interval_sec: %d (must be >= 10)",
             config->heartbeat_interval_sec);
@@ -127,6 +186,16 @@ chat_server_t* server_create(const server_config_t* config) {
     server->client_count = 0;
     server->next_client_id = 1;  // 0 ȿ
     server->should_shutdown = 0;
+    server->room.next_sequence = 1;  // 0 " ޽ "
+    QueryPerformanceFrequency(&server->perf_frequency);
+    server->zerocopy_poll_ms = SERVER_ZEROCOPY_POLL_MS;
+
+    if (server->config.enable_compression) {
+        server->compressor = compress_context_create();
+        if (!server->compressor) {
+            LOG_WARNING("Compression unavailable, frames will be sent uncompressed");
+        }
+    }
 
     // Ŭ̾Ʈ 迭 ʱȭ
     for (int i = 0; i < MAX_SERVER_CLIENTS; i++) {
@@ -139,16 +208,19 @@ chat_server_t* server_create(const server_config_t* config) {
     // FD  ʱȭ
     FD_ZERO(&server->master_read_fds);
     FD_ZERO(&server->working_read_fds);
+    FD_ZERO(&server->master_write_fds);
+    FD_ZERO(&server->working_write_fds);
     server->max_fd = 0;
 
     // ð ʱȭ
-    time_t current_time = time(NULL);
-    server->last_heartbeat_check = current_time;
-    server->last_cleanup = current_time;
+    uint64_t now_ms = utils_clock_update();
+    server->last_heartbeat_check = now_ms;
+    server->last_cleanup = now_ms;
 
     //  ʱȭ
     memset(&server->stats, 0, sizeof(server_statistics_t));
-    server->stats.start_time = current_time;
+    server->stats.start_time = time(NULL);
+    server->stats.start_ms = now_ms;
 
     LOG_INFO("Server instance created successfully");
     LOG_INFO("Configuration: port=%d, max_clients=%d, heartbeat=%s",
@@ -176,12 +248,15 @@ void server_destroy(chat_server_t* server) {
     for (int i = 0; i < MAX_SERVER_CLIENTS; i++) {
         if (server->clients[i].is_active && server->clients[i].socket) {
             LOG_DEBUG("Closing client %d connection during destroy", server->clients[i].id);
+            server_discard_batch(&server->clients[i]);
+            network_socket_discard_queue(server->clients[i].socket, &server->clients[i].send_queue);
             network_socket_close(server->clients[i].socket);
             network_socket_destroy(server->clients[i].socket);
             server->clients[i].socket = NULL;
             server->clients[i].is_active = 0;
         }
     }
+    server_clear_batch_cache(server);
 
     //   
     if (server->listen_socket) {
@@ -190,6 +265,15 @@ void server_destroy(chat_server_t* server) {
         server->listen_socket = NULL;
     }
 
+    // äù ֱ ޽ 
+    for (int i = 0; i < SERVER_ROOM_BACKLOG_SIZE; i++) {
+        network_frame_release(server->room.frames[i]);
+        server->room.frames[i] = NULL;
+    }
+
+    compress_context_destroy(server->compressor);
+    server->compressor = NULL;
+
     //   
     if (g_server_instance == server) {
         g_server_instance = NULL;
@@ -221,7 +305,7 @@ int server_get_uptime_seconds(const chat_server_t* server) {
         return 0;
     }
 
-    return (int)(time(NULL) - server->stats.start_time);
+    return (int)((utils_clock_now_ms() - server->stats.start_ms) / 1000);
 }
 
 void server_print_status(const chat_server_t* server) {
@@ -263,6 +347,38 @@ void server_print_statistics(const chat_server_t* server) {
     printf("Bytes received: %s\n", bytes_received_str);
     printf("Auth failures: %u\n", stats->authentication_failures);
     printf("Protocol errors: %u\n", stats->protocol_errors);
+    printf("Rejected (server full): %u\n", stats->rejected_connections);
+    printf("Sessions resumed: %u (replayed %u messages)\n", stats->sessions_resumed, stats->messages_replayed);
+    printf("Duplicate chats dropped: %u\n", stats->duplicate_chats);
+    printf("Frames flushed: %llu in %llu send calls (%.2f frames/call)\n",
+        stats->frames_flushed, stats->send_calls,
+        stats->send_calls > 0 ? (double)stats->frames_flushed / (double)stats->send_calls : 0.0);
+    printf("Slow consumers dropped: %u (queue full), %u (not drained within RTT budget)\n",
+        stats->slow_consumers, stats->lagging_consumers);
+    printf("TCP segments (est.): %llu (%.2f packets/message, nodelay: %s, batching: %s)\n",
+        stats->segments_estimated,
+        stats->frames_flushed > 0 ? (double)stats->segments_estimated / (double)stats->frames_flushed : 0.0,
+        server->config.tcp_nodelay ? "on" : "off",
+        server->config.batch_writes ? "on" : "off");
+    printf("Zero-copy sends: %u (threshold: %u bytes)\n", stats->zerocopy_sends, server->config.zerocopy_threshold);
+    utils_bytes_to_human_readable(stats->compression_saved_bytes, bytes_sent_str, sizeof(bytes_sent_str));
+    printf("Compressed frames: %llu (saved %s", stats->compressed_frames, bytes_sent_str);
+    if (server->compressor && server->compressor->bytes_in > 0) {
+        printf(", ratio %.2f", (double)server->compressor->bytes_out / (double)server->compressor->bytes_in);
+    }
+    printf(")\n");
+    printf("Batched frames: %llu in %llu batches (%.2f frames/batch, %llu shared)\n",
+        stats->frames_batched, stats->batches_sent,
+        stats->batches_sent > 0 ? (double)stats->frames_batched / (double)stats->batches_sent : 0.0,
+        stats->batches_shared);
+    printf("Presence changes: %u (collapsed %u, %u digests, window %u ms)\n",
+        stats->presence_changes, stats->presence_collapsed, stats->presence_digests,
+        server->config.presence_window_ms);
+    printf("Heartbeats: %llu sent, %llu elided (recent traffic)\n",
+        stats->heartbeats_sent, stats->heartbeats_elided);
+    printf("Queue-to-wire latency: avg %.1f us, max %.1f us\n",
+        stats->flush_latency_samples > 0 ? stats->flush_latency_total_us / (double)stats->flush_latency_samples : 0.0,
+        stats->flush_latency_max_us);
 }
 
 void server_print_client_list(const chat_server_t* server) {
@@ -281,7 +397,15 @@ void server_print_client_list(const chat_server_t* server) {
             char connected_time[TIME_STRING_SIZE];
             utils_time_to_string(client->connected_at, connected_time, sizeof(connected_time));
 
-            printf("Client %u: %s (%s:%d) - Connected: %s - Auth: %s - Messages: %u/%u\n",
+            char rtt_text[48];
+            if (client->rtt.samples > 0) {
+                sprintf_s(rtt_text, sizeof(rtt_text), "%.1f ms (+/- %.1f)", client->rtt.srtt_ms, client->rtt.rttvar_ms);
+            }
+            else {
+                utils_string_copy(rtt_text, sizeof(rtt_text), "-");
+            }
+
+            printf("Client %u: %s (%s:%d) - Connected: %s - Auth: %s - Messages: %u/%u - RTT: %s - Queued: %d\n",
                 client->id,
                 utils_string_is_empty(client->username) ? "[Anonymous]" : client->username,
                 client->socket->remote_ip,
@@ -289,7 +413,9 @@ void server_print_client_list(const chat_server_t* server) {
                 connected_time,
                 client->is_authenticated ? "Yes" : "No",
                 client->messages_sent,
-                client->messages_received);
+                client->messages_received,
+                rtt_text,
+                client->send_queue.count);
             active_count++;
         }
     }
@@ -422,7 +548,7 @@ int server_start(chat_server_t* server) {
     }
 
     //  
-    if (network_socket_listen(server->listen_socket, MAX_PENDING_CONNECTIONS) != NETWORK_SUCCESS) {
+    if (network_socket_listen(server->listen_socket, server->config.listen_backlog) != NETWORK_SUCCESS) {
         LOG_ERROR("Failed to start listening");
         network_socket_destroy(server->listen_socket);
         server->listen_socket = NULL;
@@ -430,15 +556,30 @@ int server_start(chat_server_t* server) {
         return -1;
     }
 
+    // ̳ʸ Ʈ̽  (ص   )
+    if (!utils_string_is_empty(server->config.trace_file)) {
+        if (trace_open(server->config.trace_file, server->config.trace_capacity) != 0) {
+            LOG_WARNING("Failed to open trace file, tracing disabled");
+        }
+    }
+
+    // Ʈ ĸó  (÷ )
+    if (!utils_string_is_empty(server->config.capture_file)) {
+        if (capture_open(server->config.capture_file) != 0) {
+            LOG_WARNING("Failed to open capture file, capture disabled");
+        }
+    }
+
     // FD  ʱȭ
     FD_ZERO(&server->master_read_fds);
+    FD_ZERO(&server->master_write_fds);
     FD_SET(server->listen_socket->handle, &server->master_read_fds);
     server->max_fd = server->listen_socket->handle;
 
     // ð ʱȭ
-    time_t current_time = time(NULL);
-    server->last_heartbeat_check = current_time;
-    server->last_cleanup = current_time;
+    uint64_t now_ms = utils_clock_update();
+    server->last_heartbeat_check = now_ms;
+    server->last_cleanup = now_ms;
     server->should_shutdown = 0;
 
     server->state = SERVER_STATE_RUNNING;
@@ -468,6 +609,7 @@ int server_stop(chat_server_t* server) {
         server_broadcast_message(server, disconnect_msg, 0);  //  Ŭ̾Ʈ
         message_destroy(disconnect_msg);
     }
+    server_flush_clients(server);
 
     //  Ͽ Ŭ̾Ʈ     ֵ 
     Sleep(1000);
@@ -477,6 +619,8 @@ int server_stop(chat_server_t* server) {
     for (int i = 0; i < MAX_SERVER_CLIENTS; i++) {
         if (server->clients[i].is_active && server->clients[i].socket) {
             LOG_DEBUG("Closing connection to client %d", server->clients[i].id);
+            server_discard_batch(&server->clients[i]);
+            network_socket_discard_queue(server->clients[i].socket, &server->clients[i].send_queue);
             network_socket_close(server->clients[i].socket);
             network_socket_destroy(server->clients[i].socket);
             server->clients[i].socket = NULL;
@@ -499,9 +643,15 @@ int server_stop(chat_server_t* server) {
     // FD  ʱȭ
     FD_ZERO(&server->master_read_fds);
     FD_ZERO(&server->working_read_fds);
+    FD_ZERO(&server->master_write_fds);
+    FD_ZERO(&server->working_write_fds);
     server->max_fd = 0;
     server->client_count = 0;
 
+    // ̳ʸ Ʈ̽  ĸó 
+    trace_close();
+    capture_close();
+
     server->state = SERVER_STATE_STOPPED;
     LOG_INFO("Server stopped successfully");
 
@@ -522,19 +672,43 @@ int server_run(chat_server_t* server) {
     LOG_INFO("Server main loop started (PID: %d)", GetCurrentProcessId());
 
     struct timeval timeout;
-    time_t last_log_time = time(NULL);
+    uint64_t last_log_ms = utils_clock_update();
 
     //  
     while (!server->should_shutdown && server->state == SERVER_STATE_RUNNING) {
-        // select ŸӾƿ 
-        timeout.tv_sec = server->config.select_timeout_ms / 1000;
-        timeout.tv_usec = (server->config.select_timeout_ms % 1000) * 1000;
+        // select ŸӾƿ  ( ī  Ϸ select   Ƿ ª Ȯϵ,
+        //  ó Ϸᰡ ʾ   辿 ÷  굹 ʰ )
+        int timeout_ms = server->config.select_timeout_ms;
+        if (server->zerocopy_pending > 0) {
+            if (server->zerocopy_poll_ms < timeout_ms) {
+                timeout_ms = server->zerocopy_poll_ms;
+            }
+            server->zerocopy_poll_ms = server->zerocopy_poll_ms * 2 > SERVER_ZEROCOPY_POLL_MAX_MS ?
+                SERVER_ZEROCOPY_POLL_MAX_MS : server->zerocopy_poll_ms * 2;
+        }
+        else {
+            server->zerocopy_poll_ms = SERVER_ZEROCOPY_POLL_MS;
+        }
+
+        //   /      
+        if (server->room.presence_count > 0) {
+            uint64_t elapsed_ms = utils_clock_now_ms() - server->room.presence_since_ms;
+            int remaining_ms = elapsed_ms >= server->config.presence_window_ms ? 0 :
+                (int)(server->config.presence_window_ms - elapsed_ms);
+            if (remaining_ms < timeout_ms) {
+                timeout_ms = remaining_ms;
+            }
+        }
+        timeout.tv_sec = timeout_ms / 1000;
+        timeout.tv_usec = (timeout_ms % 1000) * 1000;
 
         // ۾ FD  
         server->working_read_fds = server->master_read_fds;
+        server->working_write_fds = server->master_write_fds;
 
-        // select ȣ
-        int activity = select(0, &server->working_read_fds, NULL, NULL, &timeout);
+        // select ȣ ( Ͱ       ε ٸ)
+        fd_set* write_fds = server->working_write_fds.fd_count > 0 ? &server->working_write_fds : NULL;
+        int activity = select(0, &server->working_read_fds, write_fds, NULL, &timeout);
 
         if (activity == SOCKET_ERROR) {
             int error = WSAGetLastError();
@@ -547,7 +721,8 @@ int server_run(chat_server_t* server) {
             break;
         }
 
-        time_t current_time = time(NULL);
+        // ̹ ݺ ð (ڵ鷯 Ÿ̸Ӵ    )
+        uint64_t now_ms = utils_clock_update();
 
         if (activity > 0) {
             // ο  Ȯ
@@ -560,28 +735,33 @@ int server_run(chat_server_t* server) {
         }
 
         // ֱ  ۾ (5ʸ)
-        if (current_time - server->last_cleanup >= 5) {
+        if (now_ms - server->last_cleanup >= 5000) {
             server_cleanup_inactive_clients(server);
-            server->last_cleanup = current_time;
+            server->last_cleanup = now_ms;
         }
 
-        // ƮƮ Ȯ
-        if (server->config.enable_heartbeat &&
-            current_time - server->last_heartbeat_check >= server->config.heartbeat_interval_sec) {
+        // ƮƮ Ȯ ( Ḷ ٸǷ  Ȯ)
+        if (server->config.enable_heartbeat && now_ms - server->last_heartbeat_check >= 1000) {
             server_check_heartbeats(server);
-            server->last_heartbeat_check = current_time;
+            server->last_heartbeat_check = now_ms;
         }
 
+        //      / ť 
+        server_flush_presence(server, 0);
+
+        // ̹    Ḷ   
+        server_flush_clients(server);
+
         // FD  Ʈ
         server_update_fd_sets(server);
 
         // ֱ  α (1и)
-        if (current_time - last_log_time >= 60) {
+        if (now_ms - last_log_ms >= 60000) {
             LOG_INFO("Server running - Active clients: %d/%d, Uptime: %d seconds",
                 server_get_active_client_count(server),
                 server->config.max_clients,
                 server_get_uptime_seconds(server));
-            last_log_time = current_time;
+            last_log_ms = now_ms;
         }
     }
 
@@ -604,42 +784,59 @@ static void server_handle_new_connection(chat_server_t* server) {
         return;
     }
 
-    // ִ Ŭ̾Ʈ  Ȯ
-    if (server_get_active_client_count(server) >= server->config.max_clients) {
-        //  ް   ޽    
-        network_socket_t* temp_socket = network_socket_accept(server->listen_socket);
-        if (temp_socket) {
-            LOG_WARNING("Server full, rejecting connection from %s:%d",
-                temp_socket->remote_ip, temp_socket->remote_port);
-
-            message_t* error_msg = message_create_error(RESPONSE_SERVER_FULL,
-                "Server is full. Please try again later.");
-            if (error_msg) {
-                network_socket_send_message(temp_socket, error_msg);
-                message_destroy(error_msg);
-            }
+    //   ⿭ 길ŭ  (翬  select   ϳ  )
+    for (int accepted = 0; accepted < SERVER_ACCEPT_BUDGET; accepted++) {
+        network_socket_t* client_socket = network_socket_accept(server->listen_socket);
+        if (!client_socket) {
+            return;  // ⿭ ų  (ŷ 忡 )
+        }
 
-            Sleep(100);  // ޽  ð Ȯ
-            network_socket_close(temp_socket);
-            network_socket_destroy(temp_socket);
+        // ִ Ŭ̾Ʈ  Ȯ
+        if (server_get_active_client_count(server) >= server->config.max_clients) {
+            server_reject_connection(server, client_socket);
+            continue;
         }
-        return;
+
+        server_admit_connection(server, client_socket);
     }
 
-    //   
-    network_socket_t* client_socket = network_socket_accept(server->listen_socket);
-    if (!client_socket) {
-        return;  //  ų  (ŷ 忡 )
+    LOG_DEBUG("Accept budget (%d) used up, remaining connections wait for the next loop", SERVER_ACCEPT_BUDGET);
+}
+
+static void server_reject_connection(chat_server_t* server, network_socket_t* temp_socket) {
+    LOG_WARNING("Server full, rejecting connection from %s:%d",
+        temp_socket->remote_ip, temp_socket->remote_port);
+
+    // õ ð   Ŭ̾Ʈ Ѳ ٽ  ʰ 
+    uint32_t retry_after_sec = utils_random_between(SERVER_FULL_RETRY_AFTER_SEC,
+        SERVER_FULL_RETRY_AFTER_SEC * 2);
+    server->stats.rejected_connections++;
+
+    //   ۽ ۴  Ƿ   ŷ  
+    //  ڿ Ŀ  ͸  ϹǷ ٸ 
+    message_t* error_msg = message_create_server_full(retry_after_sec);
+    if (error_msg) {
+        network_socket_send_message(temp_socket, error_msg);
+        message_destroy(error_msg);
     }
 
+    network_socket_close(temp_socket);
+    network_socket_destroy(temp_socket);
+}
+
+static void server_admit_connection(chat_server_t* server, network_socket_t* client_socket) {
     LOG_INFO("New connection from %s:%d", client_socket->remote_ip, client_socket->remote_port);
 
-    // Ŭ̾Ʈ  ŷ  
-    if (network_socket_set_nonblocking(client_socket) != NETWORK_SUCCESS) {
-        LOG_ERROR("Failed to set client socket to non-blocking mode");
-        network_socket_close(client_socket);
-        network_socket_destroy(client_socket);
-        return;
+    //     ŷ 带 Ƿ   
+    //      Ƿ Nagle     ʿ䰡 
+    if (server->config.tcp_nodelay && network_socket_set_nodelay(client_socket, 1) != NETWORK_SUCCESS) {
+        LOG_WARNING("Failed to disable Nagle for %s:%d", client_socket->remote_ip, client_socket->remote_port);
+    }
+
+    // ۽ ۸ ָ overlapped     ʰ ״ 
+    // (SO_SNDBUF=0 Ӱ谪 ̸       ۽ſ )
+    if (server->config.zerocopy_threshold > 0 && network_socket_set_send_buffer(client_socket, 0) != NETWORK_SUCCESS) {
+        LOG_WARNING("Failed to enable zero-copy sends for %s:%d", client_socket->remote_ip, client_socket->remote_port);
     }
 
     //  Ŭ̾Ʈ ߰
@@ -651,6 +848,9 @@ static void server_handle_new_connection(chat_server_t* server) {
         return;
     }
 
+    TRACE_EVENT(TRACE_EVENT_ACCEPT, client_id, 0, 0);
+    CAPTURE_OPEN(client_id);
+
     //  Ʈ
     server->stats.total_connections++;
     server->stats.current_connections = server_get_active_client_count(server);
@@ -682,7 +882,7 @@ static void server_handle_client_data(chat_server_t* server) {
 
             if (received_msg) {
                 // ޽  
-                client->last_activity = time(NULL);
+                client->last_activity = utils_clock_now_ms();
                 client->messages_received++;
                 server->stats.total_messages++;
 
@@ -690,8 +890,16 @@ static void server_handle_client_data(chat_server_t* server) {
                     message_type_to_string((message_type_t)ntohs(received_msg->header.type)),
                     client->id);
 
+                uint32_t client_id = client->id;
+                uint16_t msg_type = ntohs(received_msg->header.type);
+                TRACE_EVENT(TRACE_EVENT_FRAME_RECV, client_id, msg_type,
+                    (uint32_t)message_get_total_size(received_msg));
+                CAPTURE_FRAME(client_id, received_msg);
+
                 // ޽ ó (Part 3  message_handler ȣ)
+                TRACE_EVENT(TRACE_EVENT_HANDLER_START, client_id, msg_type, 0);
                 server_process_client_message(server, client, received_msg);
+                TRACE_EVENT(TRACE_EVENT_HANDLER_END, client_id, msg_type, 0);
 
                 message_destroy(received_msg);
 
@@ -723,7 +931,9 @@ void server_update_fd_sets(chat_server_t* server) {
 
     //  FD  籸
     FD_ZERO(&server->master_read_fds);
+    FD_ZERO(&server->master_write_fds);
     server->max_fd = 0;
+    server->zerocopy_pending = 0;
 
     //   ߰
     if (server->listen_socket && server->listen_socket->handle != INVALID_SOCKET) {
@@ -740,6 +950,12 @@ void server_update_fd_sets(chat_server_t* server) {
             client->socket->handle != INVALID_SOCKET) {
 
             FD_SET(client->socket->handle, &server->master_read_fds);
+            if (client->send_queue.zerocopy_pending) {
+                server->zerocopy_pending++;
+            }
+            else if (client->send_queue.count > 0) {
+                FD_SET(client->socket->handle, &server->master_write_fds);
+            }
             if (client->socket->handle > server->max_fd) {
                 server->max_fd = client->socket->handle;
             }
@@ -747,12 +963,73 @@ void server_update_fd_sets(chat_server_t* server) {
     }
 }
 
+int server_flush_clients(chat_server_t* server) {
+    if (!server) {
+        return 0;
+    }
+
+    int removed_count = 0;
+    int removed_this_pass;
+
+    // ϸ鼭  ˸ ٸ Ŭ̾Ʈ ť   Ƿ      ݺ
+    do {
+        removed_this_pass = 0;
+
+        for (int i = 0; i < MAX_SERVER_CLIENTS; i++) {
+            client_info_t* client = &server->clients[i];
+
+            if (!client->is_active || !client->socket) {
+                continue;
+            }
+
+            if (client->is_overflowed) {
+                LOG_WARNING("Client %d is not reading (%d frames, %u bytes queued), disconnecting",
+                    client->id, client->send_queue.count, client->send_queue.queued_bytes);
+                server->stats.slow_consumers++;
+                server_remove_client(server, client->id);
+                removed_this_pass++;
+                continue;
+            }
+
+            if (client->send_queue.count == 0 && client->batch_count == 0) {
+                continue;
+            }
+
+            network_result_t result = server_flush_client(server, client);
+            if (result == NETWORK_DISCONNECTED || result == NETWORK_ERROR || result == NETWORK_INVALID_SOCKET) {
+                LOG_DEBUG("Failed to flush client %d: %s", client->id, network_result_to_string(result));
+                server_remove_client(server, client->id);
+                removed_this_pass++;
+                continue;
+            }
+
+            // Ʈũ  ŭ ٷ ֵ ׺     (簳ϸ ֱ ä ٽ )
+            double wait_ms = server_queue_wait_ms(server, client);
+            if (wait_ms > server_drain_budget_ms(client)) {
+                LOG_WARNING("Client %d has not drained its queue for %.0f ms (RTT %.1f ms), disconnecting",
+                    client->id, wait_ms, client->rtt.srtt_ms);
+                server->stats.lagging_consumers++;
+                server_remove_client(server, client->id);
+                removed_this_pass++;
+            }
+        }
+
+        removed_count += removed_this_pass;
+    } while (removed_this_pass > 0);
+
+    //   ť   Ƿ    ʿ 
+    server_clear_batch_cache(server);
+
+    return removed_count;
+}
+
 int server_cleanup_inactive_clients(chat_server_t* server) {
     if (!server) {
         return 0;
     }
 
-    time_t current_time = time(NULL);
+    uint64_t now_ms = utils_clock_now_ms();
+    uint64_t timeout_ms = (uint64_t)server->config.client_timeout_sec * 1000;
     int cleaned_count = 0;
 
     for (int i = 0; i < MAX_SERVER_CLIENTS; i++) {
@@ -763,9 +1040,9 @@ int server_cleanup_inactive_clients(chat_server_t* server) {
         }
 
         // ŸӾƿ üũ
-        if (current_time - client->last_activity > server->config.client_timeout_sec) {
+        if (now_ms - client->last_activity > timeout_ms) {
             LOG_WARNING("Client %d timed out (last activity: %d seconds ago)",
-                client->id, (int)(current_time - client->last_activity));
+                client->id, (int)((now_ms - client->last_activity) / 1000));
             server_remove_client(server, client->id);
             cleaned_count++;
             continue;
@@ -779,6 +1056,9 @@ int server_cleanup_inactive_clients(chat_server_t* server) {
         }
     }
 
+    //  ð  簳     ó
+    cleaned_count += server_expire_detached_sessions(server, now_ms);
+
     if (cleaned_count > 0) {
         LOG_INFO("Cleaned up %d inactive clients", cleaned_count);
         //  Ʈ
@@ -793,41 +1073,82 @@ int server_check_heartbeats(chat_server_t* server) {
         return 0;
     }
 
-    time_t current_time = time(NULL);
+    uint64_t now_ms = utils_clock_now_ms();
+    uint64_t interval_ms = (uint64_t)server->config.heartbeat_interval_sec * 1000;
     int heartbeat_count = 0;
-
-    message_t* heartbeat_msg = message_create(MSG_HEARTBEAT, NULL, 0);
-    if (!heartbeat_msg) {
-        LOG_ERROR("Failed to create heartbeat message");
-        return 0;
-    }
+    network_frame_t* heartbeat_frame = NULL;
 
     for (int i = 0; i < MAX_SERVER_CLIENTS; i++) {
         client_info_t* client = &server->clients[i];
 
-        if (!client->is_active || !client->is_authenticated) {
+        if (!client->is_active || !client->is_authenticated || now_ms < client->heartbeat_due) {
+            continue;
+        }
+
+        //  ȿ     ִ ̹Ƿ    ٽ 
+        if (now_ms - client->last_activity < interval_ms) {
+            server_schedule_heartbeat(server, client, client->last_activity);
+            server->stats.heartbeats_elided++;
+            continue;
+        }
+
+        // ť    + Ʈũ  ̻ з      (   )
+        if (client->send_queue.count > 0 && server_queue_wait_ms(server, client) >
+            server->config.select_timeout_ms + network_rtt_timeout_ms(&client->rtt)) {
+            server_schedule_heartbeat(server, client, now_ms);
+            server->stats.heartbeats_elided++;
             continue;
         }
 
-        // ƮƮ ʿ Ȯ
-        if (current_time - client->last_heartbeat >= server->config.heartbeat_interval_sec) {
-            if (server_send_to_client(server, client->id, heartbeat_msg) == 0) {
-                client->last_heartbeat = current_time;
-                heartbeat_count++;
-                LOG_DEBUG("Sent heartbeat to client %d", client->id);
+        // ƮƮ ʿ      ( ð ACK ƿ RTT ǥ )
+        if (!heartbeat_frame) {
+            message_t* heartbeat_msg = message_create_heartbeat(MSG_HEARTBEAT, network_rtt_timestamp(), 0);
+            heartbeat_frame = network_frame_create(heartbeat_msg);
+            message_destroy(heartbeat_msg);
+            if (!heartbeat_frame) {
+                LOG_ERROR("Failed to create heartbeat message");
+                return heartbeat_count;
             }
         }
+
+        if (server_queue_frame(server, client, heartbeat_frame) == 0) {
+            client->last_heartbeat = now_ms;
+            heartbeat_count++;
+            LOG_DEBUG("Sent heartbeat to client %d", client->id);
+        }
+        server_schedule_heartbeat(server, client, now_ms);
     }
 
-    message_destroy(heartbeat_msg);
+    network_frame_release(heartbeat_frame);
 
     if (heartbeat_count > 0) {
+        server->stats.heartbeats_sent += (uint64_t)heartbeat_count;
         LOG_DEBUG("Sent heartbeat to %d clients", heartbeat_count);
     }
 
     return heartbeat_count;
 }
 
+static double server_queue_wait_ms(const chat_server_t* server, const client_info_t* client) {
+    if (client->send_queue.count == 0 || server->perf_frequency.QuadPart == 0) {
+        return 0.0;
+    }
+
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    return (double)(now.QuadPart - client->pending_since) * 1000.0 / (double)server->perf_frequency.QuadPart;
+}
+
+static double server_drain_budget_ms(const client_info_t* client) {
+    return SERVER_DRAIN_TIMEOUT_MS + SERVER_DRAIN_RTO_FACTOR * network_rtt_timeout_ms(&client->rtt);
+}
+
+static void server_schedule_heartbeat(chat_server_t* server, client_info_t* client, uint64_t from_ms) {
+    //  1/4 ȿ    ð  鵵 Ѳ   ʰ 
+    uint32_t interval_ms = (uint32_t)server->config.heartbeat_interval_sec * 1000;
+    client->heartbeat_due = from_ms + interval_ms + utils_random_between(0, interval_ms / 4);
+}
+
 // =============================================================================
 // Ŭ̾Ʈ  Լ
 // =============================================================================
@@ -861,13 +1182,16 @@ uint32_t server_add_client(chat_server_t* server, network_socket_t* client_socke
     client->is_active = 1;
     client->is_authenticated = 0;  //   
 
-    time_t current_time = time(NULL);
-    client->connected_at = current_time;
-    client->last_activity = current_time;
-    client->last_heartbeat = current_time;
+    uint64_t now_ms = utils_clock_now_ms();
+    client->connected_at = time(NULL);
+    client->last_activity = now_ms;
+    client->last_heartbeat = now_ms;
+    server_schedule_heartbeat(server, client, now_ms);
 
     client->messages_sent = 0;
     client->messages_received = 0;
+    client->send_queue.segment_size = network_socket_get_mss(client_socket);
+    client->send_queue.zerocopy_threshold = server->config.zerocopy_threshold;
 
     // ڸ   
     utils_string_copy(client->username, sizeof(client->username), "");
@@ -899,26 +1223,23 @@ int server_remove_client(chat_server_t* server, uint32_t client_id) {
     LOG_INFO("Removing client %d (%s)", client_id,
         utils_string_is_empty(client->username) ? "[Anonymous]" : client->username);
 
+    TRACE_EVENT(TRACE_EVENT_DISCONNECT, client_id, 0, 0);
+    CAPTURE_CLOSE(client_id);
+
     // ٸ Ŭ̾Ʈ鿡   ˸ (  )
+    //     簳  ð  ˸ 
     if (client->is_authenticated && !utils_string_is_empty(client->username)) {
-        //   ޽ 
-        char leave_message[256];
-        sprintf_s(leave_message, sizeof(leave_message), "%s has left the chat", client->username);
-
-        message_t* leave_msg = message_create_chat(0, "System", leave_message);
-        if (leave_msg) {
-            server_broadcast_to_authenticated(server, leave_msg, client_id);
-            message_destroy(leave_msg);
+        if (client->is_leaving || server_detach_session(server, client) != 0) {
+            server_announce_presence(server, client->username, 0, client_id);
         }
+    }
 
-        //   ý ޽
-        message_t* user_left_msg = message_create(MSG_USER_LEFT, client->username,
-            strlen(client->username));
-        if (user_left_msg) {
-            server_broadcast_to_authenticated(server, user_left_msg, client_id);
-            message_destroy(user_left_msg);
-        }
+    //      ִ ŭ   
+    if (client->socket && (client->send_queue.count > 0 || client->batch_count > 0) && !client->is_overflowed) {
+        server_flush_client(server, client);
     }
+    server_discard_batch(client);
+    network_socket_discard_queue(client->socket, &client->send_queue);
 
     //     
     if (client->socket) {
@@ -999,24 +1320,14 @@ int server_send_to_client(chat_server_t* server, uint32_t client_id, const messa
         return -1;
     }
 
-    network_result_t result = network_socket_send_message(client->socket, message);
-
-    if (result == NETWORK_SUCCESS) {
-        client->messages_sent++;
-        client->last_activity = time(NULL);
-        server->stats.total_bytes_sent += client->socket->bytes_sent;
-        return 0;
-    }
-    else {
-        LOG_DEBUG("Failed to send message to client %d: %s",
-            client_id, network_result_to_string(result));
-
-        if (result == NETWORK_DISCONNECTED) {
-            //    Ŭ̾Ʈ 
-            server_remove_client(server, client_id);
-        }
+    network_frame_t* frame = network_frame_create(message);
+    if (!frame) {
         return -1;
     }
+
+    int result = server_queue_frame(server, client, frame);
+    network_frame_release(frame);
+    return result;
 }
 
 int server_broadcast_message(chat_server_t* server, const message_t* message, uint32_t exclude_client_id) {
@@ -1024,21 +1335,30 @@ int server_broadcast_message(chat_server_t* server, const message_t* message, ui
         return 0;
     }
 
-    int sent_count = 0;
+    network_frame_t* frame = network_frame_create(message);
+    if (!frame) {
+        return 0;
+    }
 
-    for (int i = 0; i < MAX_SERVER_CLIENTS; i++) {
-        client_info_t* client = &server->clients[i];
+    int sent_count = server_broadcast_frame(server, frame, exclude_client_id, 0);
+    network_frame_release(frame);
 
-        if (!client->is_active || client->id == exclude_client_id) {
-            continue;
-        }
+    LOG_DEBUG("Broadcast message to %d clients", sent_count);
+    return sent_count;
+}
 
-        if (server_send_to_client(server, client->id, message) == 0) {
-            sent_count++;
-        }
+int server_publish_chat(chat_server_t* server, message_t* message, uint32_t exclude_client_id) {
+    if (!server || !message || ntohl(message->header.payload_size) < sizeof(chat_message_payload_t)) {
+        return 0;
     }
 
-    LOG_DEBUG("Broadcast message to %d clients", sent_count);
+    network_frame_t* frame = server_record_chat(server, message);
+    if (!frame) {
+        return 0;
+    }
+
+    int sent_count = server_broadcast_frame(server, frame, exclude_client_id, 1);
+    LOG_DEBUG("Broadcast message to %d authenticated clients", sent_count);
     return sent_count;
 }
 
@@ -1047,24 +1367,267 @@ int server_broadcast_to_authenticated(chat_server_t* server, const message_t* me
         return 0;
     }
 
+    network_frame_t* frame = network_frame_create(message);
+    if (!frame) {
+        return 0;
+    }
+
+    int sent_count = server_broadcast_frame(server, frame, exclude_client_id, 1);
+    network_frame_release(frame);
+
+    LOG_DEBUG("Broadcast message to %d authenticated clients", sent_count);
+    return sent_count;
+}
+
+static network_frame_t* server_record_chat(chat_server_t* server, message_t* message) {
+    //  ű 簳 ֱ ޽  (   )
+    uint32_t sequence = server->room.next_sequence++;
+    chat_message_payload_t* chat = (chat_message_payload_t*)message->payload;
+    chat->sequence = htonl(sequence);
+
+    network_frame_t* frame = network_frame_create(message);
+    if (!frame) {
+        return NULL;
+    }
+
+    //    ۽ ť ȭ  ϳ  (ȯ    )
+    network_frame_t** slot = &server->room.frames[sequence % SERVER_ROOM_BACKLOG_SIZE];
+    network_frame_release(*slot);
+    *slot = frame;
+    return frame;
+}
+
+static int server_broadcast_frame(chat_server_t* server, network_frame_t* frame, uint32_t exclude_client_id, int authenticated_only) {
     int sent_count = 0;
 
     for (int i = 0; i < MAX_SERVER_CLIENTS; i++) {
         client_info_t* client = &server->clients[i];
 
-        if (!client->is_active || !client->is_authenticated || client->id == exclude_client_id) {
+        if (!client->is_active || !client->socket || client->id == exclude_client_id) {
+            continue;
+        }
+        if (authenticated_only && !client->is_authenticated) {
             continue;
         }
 
-        if (server_send_to_client(server, client->id, message) == 0) {
+        if (server_queue_frame(server, client, frame) == 0) {
             sent_count++;
         }
     }
 
-    LOG_DEBUG("Broadcast message to %d authenticated clients", sent_count);
     return sent_count;
 }
 
+// =============================================================================
+// ۽ ť 
+// =============================================================================
+
+static int server_queue_frame(chat_server_t* server, client_info_t* client, network_frame_t* frame) {
+    if (client->is_overflowed) {
+        return -1;
+    }
+
+    if (client->send_queue.count == 0 && client->batch_count == 0) {
+        LARGE_INTEGER now;
+        QueryPerformanceCounter(&now);
+        client->pending_since = now.QuadPart;
+    }
+
+    TRACE_EVENT(TRACE_EVENT_WRITE_QUEUED, client->id, frame->msg_type, frame->length);
+
+    //  ⸦  Ӹ ٷ  ( , д  ܰ迡 ó)
+    if (!server->config.batch_writes) {
+        int result = server_push_frame(server, client, frame);
+        server_flush_client(server, client);
+        return result;
+    }
+
+    //       (  Ѵ   ̵ Ƿ
+    //  Ű       )
+    uint32_t item_size = NETWORK_BATCH_ITEM_SIZE(frame);
+    if (!(client->capabilities & PROTOCOL_CAP_BATCH) || item_size > NETWORK_BATCH_PAYLOAD_LIMIT / 2) {
+        server_seal_batch(server, client);
+        return server_push_frame(server, client, frame);
+    }
+
+    if (client->batch_count == SERVER_BATCH_MAX_FRAMES ||
+        client->batch_bytes + item_size > NETWORK_BATCH_PAYLOAD_LIMIT) {
+        server_seal_batch(server, client);
+    }
+
+    network_frame_retain(frame);
+    client->batch_frames[client->batch_count++] = frame;
+    client->batch_bytes += item_size;
+    return client->is_overflowed ? -1 : 0;
+}
+
+static int server_push_frame(chat_server_t* server, client_info_t* client, network_frame_t* frame) {
+    // ົ  ӿ ĳõǹǷ εĳƮ      
+    if ((client->capabilities & PROTOCOL_CAP_COMPRESSION) && frame->length >= server->config.compression_threshold) {
+        network_frame_t* compressed = network_frame_compress(frame, server->compressor);
+        if (compressed != frame) {
+            server->stats.compressed_frames++;
+            server->stats.compression_saved_bytes += frame->length - compressed->length;
+            frame = compressed;
+        }
+    }
+
+    //    (Ǵ ົ) ĳõǾ   ȯ
+    if (client->capabilities & PROTOCOL_CAP_COMPACT_HEADER) {
+        frame = network_frame_compact(frame);
+    }
+
+    // ť  áٴ  밡  ʰ ִٴ ̹Ƿ  ܰ迡 
+    if (network_send_queue_push(&client->send_queue, frame) != 0) {
+        client->is_overflowed = 1;
+        return -1;
+    }
+    return 0;
+}
+
+static void server_seal_batch(chat_server_t* server, client_info_t* client) {
+    if (client->batch_count == 0) {
+        return;
+    }
+
+    // ϳ̸ ״ ,   ϸ ϳ 
+    network_frame_t* batch = NULL;
+    if (client->batch_count > 1) {
+        batch = server_build_batch(server, client);
+    }
+
+    if (batch) {
+        if (server_push_frame(server, client, batch) == 0) {
+            server->stats.batches_sent++;
+            server->stats.frames_batched += (uint64_t)client->batch_count;
+        }
+        network_frame_release(batch);
+    }
+    else {
+        for (int i = 0; i < client->batch_count && !client->is_overflowed; i++) {
+            server_push_frame(server, client, client->batch_frames[i]);
+        }
+    }
+
+    server_discard_batch(client);
+}
+
+static network_frame_t* server_build_batch(chat_server_t* server, client_info_t* client) {
+    // εĳƮ  ڵ   Ƿ     
+    // (ົ  ӿ ĳõǹǷ ڸ ٽ  )
+    size_t list_size = (size_t)client->batch_count * sizeof(network_frame_t*);
+    for (int i = 0; i < SERVER_BATCH_CACHE_SIZE; i++) {
+        server_batch_cache_t* entry = &server->batch_cache[i];
+        if (entry->batch && entry->count == client->batch_count &&
+            memcmp(entry->frames, client->batch_frames, list_size) == 0) {
+            server->stats.batches_shared++;
+            network_frame_retain(entry->batch);
+            return entry->batch;
+        }
+    }
+
+    network_frame_t* batch = network_frame_create_batch(client->batch_frames, client->batch_count);
+    if (!batch) {
+        return NULL;
+    }
+
+    //   ׸ 
+    server_batch_cache_t* entry = &server->batch_cache[server->batch_cache_next];
+    server->batch_cache_next = (server->batch_cache_next + 1) % SERVER_BATCH_CACHE_SIZE;
+
+    for (int i = 0; i < entry->count; i++) {
+        network_frame_release(entry->frames[i]);
+    }
+    network_frame_release(entry->batch);
+
+    for (int i = 0; i < client->batch_count; i++) {
+        network_frame_retain(client->batch_frames[i]);
+        entry->frames[i] = client->batch_frames[i];
+    }
+    entry->count = client->batch_count;
+    network_frame_retain(batch);
+    entry->batch = batch;
+
+    return batch;
+}
+
+static void server_clear_batch_cache(chat_server_t* server) {
+    for (int i = 0; i < SERVER_BATCH_CACHE_SIZE; i++) {
+        server_batch_cache_t* entry = &server->batch_cache[i];
+        for (int j = 0; j < entry->count; j++) {
+            network_frame_release(entry->frames[j]);
+            entry->frames[j] = NULL;
+        }
+        network_frame_release(entry->batch);
+        entry->batch = NULL;
+        entry->count = 0;
+    }
+    server->batch_cache_next = 0;
+}
+
+static void server_discard_batch(client_info_t* client) {
+    for (int i = 0; i < client->batch_count; i++) {
+        network_frame_release(client->batch_frames[i]);
+        client->batch_frames[i] = NULL;
+    }
+    client->batch_count = 0;
+    client->batch_bytes = 0;
+}
+
+static network_result_t server_flush_client(chat_server_t* server, client_info_t* client) {
+    server_seal_batch(server, client);
+
+    uint64_t bytes_before = client->socket->bytes_sent;
+    uint32_t calls_before = client->send_queue.send_calls;
+    uint64_t segments_before = client->send_queue.segments_estimated;
+    uint32_t zerocopy_before = client->send_queue.zerocopy_sends;
+    uint32_t completions_before = client->send_queue.zerocopy_completions;
+    int frames_before = client->send_queue.count;
+
+    network_result_t result = network_socket_flush_queue(client->socket, &client->send_queue,
+        server_on_frame_flushed, client);
+
+    uint64_t bytes_sent = client->socket->bytes_sent - bytes_before;
+    server->stats.total_bytes_sent += bytes_sent;
+    server->stats.send_calls += client->send_queue.send_calls - calls_before;
+    server->stats.frames_flushed += (uint64_t)(frames_before - client->send_queue.count);
+    server->stats.segments_estimated += client->send_queue.segments_estimated - segments_before;
+    server->stats.zerocopy_sends += client->send_queue.zerocopy_sends - zerocopy_before;
+
+    // Ϸ    Ϸᵵ    Ƿ Ȯ  ó ǵ
+    if (client->send_queue.zerocopy_completions != completions_before) {
+        server->zerocopy_poll_ms = SERVER_ZEROCOPY_POLL_MS;
+    }
+
+    // ƮƮ  밡  ͸ Ȱ ħ (  ῡ   )
+    if (bytes_sent > 0 && !server->config.enable_heartbeat) {
+        client->last_activity = utils_clock_now_ms();
+    }
+
+    // ť  ù   ں Ŀο ѱ  
+    if (frames_before > 0 && client->send_queue.count == 0 && server->perf_frequency.QuadPart > 0) {
+        LARGE_INTEGER now;
+        QueryPerformanceCounter(&now);
+        double latency_us = (double)(now.QuadPart - client->pending_since) * 1000000.0 /
+            (double)server->perf_frequency.QuadPart;
+
+        server->stats.flush_latency_samples++;
+        server->stats.flush_latency_total_us += latency_us;
+        if (latency_us > server->stats.flush_latency_max_us) {
+            server->stats.flush_latency_max_us = latency_us;
+        }
+    }
+
+    return result;
+}
+
+static void server_on_frame_flushed(const network_frame_t* frame, void* context) {
+    client_info_t* client = (client_info_t*)context;
+
+    TRACE_EVENT(TRACE_EVENT_WRITE_FLUSHED, client->id, frame->msg_type, frame->length);
+    client->messages_sent++;
+}
+
 // =============================================================================
 // ⺻ ޽ ó 
 // =============================================================================
@@ -1084,10 +1647,18 @@ static void server_process_client_message(chat_server_t* server, client_info_t*
         server_handle_connect_request(server, client, message);
         break;
 
+    case MSG_SESSION_RESUME:
+        server_handle_session_resume(server, client, message);
+        break;
+
     case MSG_CHAT_SEND:
         server_handle_chat_message(server, client, message);
         break;
 
+    case MSG_CHAT_SUBMIT:
+        server_handle_chat_submit(server, client, message);
+        break;
+
     case MSG_USER_LIST_REQUEST:
         server_handle_user_list_request(server, client, message);
         break;
@@ -1132,7 +1703,7 @@ static void server_handle_connect_request(chat_server_t* server, client_info_t*
     }
 
     uint32_t payload_size = ntohl(message->header.payload_size);
-    if (payload_size < sizeof(connect_request_payload_t)) {
+    if (payload_size < CONNECT_REQUEST_MIN_SIZE) {
         LOG_ERROR("Invalid connect request payload size from client %d", client->id);
         server->stats.protocol_errors++;
 
@@ -1146,16 +1717,33 @@ static void server_handle_connect_request(chat_server_t* server, client_info_t*
     }
 
     connect_request_payload_t* request = (connect_request_payload_t*)message->payload;
+    uint32_t capabilities = payload_size >= sizeof(connect_request_payload_t) ?
+        ntohl(request->capabilities) : 0;  //  Ŭ̾Ʈ   
 
     // ڸ ȿ 
     char username[MAX_USERNAME_LENGTH];
     utils_string_copy(username, sizeof(username), request->username);
     utils_string_trim(username);
 
-    if (utils_string_is_empty(username)) {
-        LOG_WARNING("Empty username from client %d", client->id);
-        message_t* error_msg = message_create_error(RESPONSE_INVALID_INPUT,
-            "Username cannot be empty");
+    if (server_validate_username(server, client, username) != 0) {
+        return;
+    }
+
+    // 簳    ̸    
+    server_release_detached_username(server, username);
+
+    server_complete_login(server, client, username, 0, capabilities);
+}
+
+static void server_handle_session_resume(chat_server_t* server, client_info_t* client, message_t* message) {
+    if (!server || !client || !message) {
+        return;
+    }
+
+    if (client->is_authenticated) {
+        LOG_WARNING("Client %d already authenticated", client->id);
+        message_t* error_msg = message_create_error(RESPONSE_ERROR,
+            "Already authenticated");
         if (error_msg) {
             server_send_to_client(server, client->id, error_msg);
             message_destroy(error_msg);
@@ -1163,51 +1751,409 @@ static void server_handle_connect_request(chat_server_t* server, client_info_t*
         return;
     }
 
-    // ڸ ߺ Ȯ
-    if (server_find_client_by_username(server, username)) {
-        LOG_WARNING("Username '%s' already taken (client %d)", username, client->id);
-        message_t* error_msg = message_create_error(RESPONSE_USERNAME_TAKEN,
-            "Username is already taken");
+    uint32_t payload_size = ntohl(message->header.payload_size);
+    if (payload_size < SESSION_RESUME_MIN_SIZE) {
+        LOG_ERROR("Invalid session resume payload size from client %d", client->id);
+        server->stats.protocol_errors++;
+
+        message_t* error_msg = message_create_error(RESPONSE_INVALID_INPUT,
+            "Invalid request format");
         if (error_msg) {
             server_send_to_client(server, client->id, error_msg);
             message_destroy(error_msg);
         }
-        server->stats.authentication_failures++;
         return;
     }
 
-    //  
-    utils_string_copy(client->username, sizeof(client->username), username);
+    session_resume_payload_t* request = (session_resume_payload_t*)message->payload;
+    request->token[SESSION_TOKEN_LENGTH] = '\0';
+    uint32_t capabilities = payload_size >= sizeof(session_resume_payload_t) ?
+        ntohl(request->capabilities) : 0;  //  Ŭ̾Ʈ   
+
+    char username[MAX_USERNAME_LENGTH];
+    utils_string_copy(username, sizeof(username), request->username);
+    utils_string_trim(username);
+
+    // ū ڸ  ġϴ 簳   ˻
+    server_detached_session_t* detached = NULL;
+    if (!utils_string_is_empty(request->token)) {
+        for (int i = 0; i < MAX_SERVER_CLIENTS; i++) {
+            server_detached_session_t* session = &server->detached_sessions[i];
+            if (session->in_use && strcmp(session->resume_token, request->token) == 0 &&
+                strcmp(session->username, username) == 0) {
+                detached = session;
+                break;
+            }
+        }
+    }
+
+    //       ̸    ϰ Ѱܹ
+    client_info_t* stale = NULL;
+    if (!detached && !utils_string_is_empty(request->token)) {
+        stale = server_find_client_by_username(server, username);
+        if (stale && (stale == client || strcmp(stale->resume_token, request->token) != 0)) {
+            stale = NULL;
+        }
+    }
+
+    if (stale) {
+        LOG_INFO("Client %d takes over session '%s' from stale client %d", client->id, username, stale->id);
+        client->last_message_id = stale->last_message_id;
+        stale->is_authenticated = 0;  //  ˸  
+        server_remove_client(server, stale->id);
+    }
+    else if (!detached) {
+        //  ð ų  ۵ -  
+        LOG_INFO("Client %d has no resumable session for '%s', joining as new", client->id, username);
+        if (server_validate_username(server, client, username) != 0) {
+            return;
+        }
+        server_release_detached_username(server, username);
+        server_complete_login(server, client, username, 0, capabilities);
+        return;
+    }
+
+    else {
+        LOG_INFO("Client %d resumed session '%s' (offline %d seconds)",
+            client->id, username, (int)((utils_clock_now_ms() - detached->detached_at) / 1000));
+        client->last_message_id = detached->last_message_id;
+        memset(detached, 0, sizeof(server_detached_session_t));
+    }
+
+    server->stats.sessions_resumed++;
+
+    //  ˸   ڷ ϰ ģ ޽ 
+    server_complete_login(server, client, username, 1, capabilities);
+    server_replay_backlog(server, client, ntohl(request->last_sequence));
+
+    // ū  Ŭ̾Ʈ ̹   óϹǷ  ޽ ڿ 
+    server_issue_session_token(server, client);
+}
+
+static int server_validate_username(chat_server_t* server, client_info_t* client, const char* username) {
+    if (utils_string_is_empty(username)) {
+        LOG_WARNING("Empty username from client %d", client->id);
+        message_t* error_msg = message_create_error(RESPONSE_INVALID_INPUT,
+            "Username cannot be empty");
+        if (error_msg) {
+            server_send_to_client(server, client->id, error_msg);
+            message_destroy(error_msg);
+        }
+        return -1;
+    }
+
+    // /  ڴ ڸ   
+    if (utils_string_count_char(username, PRESENCE_DIGEST_SEPARATOR) > 0) {
+        LOG_WARNING("Username with separator from client %d", client->id);
+        message_t* error_msg = message_create_error(RESPONSE_INVALID_INPUT,
+            "Username cannot contain ','");
+        if (error_msg) {
+            server_send_to_client(server, client->id, error_msg);
+            message_destroy(error_msg);
+        }
+        return -1;
+    }
+
+    // ڸ ߺ Ȯ
+    if (server_find_client_by_username(server, username)) {
+        LOG_WARNING("Username '%s' already taken (client %d)", username, client->id);
+        message_t* error_msg = message_create_error(RESPONSE_USERNAME_TAKEN,
+            "Username is already taken");
+        if (error_msg) {
+            server_send_to_client(server, client->id, error_msg);
+            message_destroy(error_msg);
+        }
+        server->stats.authentication_failures++;
+        return -1;
+    }
+
+    return 0;
+}
+
+static void server_complete_login(chat_server_t* server, client_info_t* client, const char* username, int resumed,
+    uint32_t requested_capabilities) {
+    //  
+    utils_string_copy(client->username, sizeof(client->username), username);
     client->is_authenticated = 1;
-    client->last_activity = time(NULL);
+    client->last_activity = utils_clock_now_ms();
 
-    LOG_INFO("Client %d authenticated as '%s'", client->id, username);
+    LOG_INFO("Client %d authenticated as '%s'%s", client->id, username, resumed ? " (resumed)" : "");
+
+    // û    ϴ ͸ 
+    uint32_t capabilities = 0;
+    if ((requested_capabilities & PROTOCOL_CAP_COMPRESSION) && server->compressor) {
+        capabilities |= PROTOCOL_CAP_COMPRESSION;
+    }
+    if ((requested_capabilities & PROTOCOL_CAP_COMPACT_HEADER) && server->config.enable_compact_header) {
+        capabilities |= PROTOCOL_CAP_COMPACT_HEADER;
+    }
+    if ((requested_capabilities & PROTOCOL_CAP_BATCH) && server->config.batch_writes) {
+        capabilities |= PROTOCOL_CAP_BATCH;
+    }
+    if (requested_capabilities & PROTOCOL_CAP_PRESENCE_DIGEST) {
+        capabilities |= PROTOCOL_CAP_PRESENCE_DIGEST;
+    }
 
     //   
     message_t* response = message_create_connect_response(RESPONSE_SUCCESS,
-        "Welcome to the chat server!",
-        client->id);
+        resumed ? "Session resumed" : "Welcome to the chat server!",
+        client->id, capabilities);
     if (response) {
         server_send_to_client(server, client->id, response);
         message_destroy(response);
     }
 
-    // ٸ ڵ鿡  ˸
-    char join_message[256];
-    sprintf_s(join_message, sizeof(join_message), "%s has joined the chat", username);
+    // Ŭ̾Ʈ   ڿ  Ǯ  Ƿ   Ӻ 
+    client->capabilities = capabilities;
+
+    // Ŭ̾Ʈ û     ƹ͵  Ƿ ŵ ⼭ ٷ ȯ
+    if (capabilities & PROTOCOL_CAP_COMPACT_HEADER) {
+        network_socket_enable_compact_header(client->socket);
+    }
+
+    // ٸ ڵ鿡  ˸ (簳   ˸  ʾǷ )
+    if (!resumed) {
+        server_announce_presence(server, username, 1, client->id);
+        server_issue_session_token(server, client);
+    }
+}
+
+static void server_announce_presence(chat_server_t* server, const char* username, int joined, uint32_t exclude_client_id) {
+    //   渶 ٷ ˸
+    if (server->config.presence_window_ms == 0) {
+        char notice[256];
+        sprintf_s(notice, sizeof(notice), joined ? "%s has joined the chat" : "%s has left the chat", username);
+
+        message_t* notice_msg = message_create_chat(0, "System", notice);
+        if (notice_msg) {
+            server_publish_chat(server, notice_msg, exclude_client_id);
+            message_destroy(notice_msg);
+        }
+
+        //  / ý ޽
+        message_t* presence_msg = message_create(joined ? MSG_USER_JOINED : MSG_USER_LEFT, username,
+            (uint32_t)strlen(username));
+        if (presence_msg) {
+            server_broadcast_to_authenticated(server, presence_msg, exclude_client_id);
+            message_destroy(presence_msg);
+        }
+        return;
+    }
+
+    server_room_t* room = &server->room;
+    server->stats.presence_changes++;
+
+    //  ˸  ݴ      Ϸ  ( ִ κ ⼭ )
+    for (int i = 0; i < room->presence_count; i++) {
+        if (strcmp(room->presence[i].username, username) != 0) {
+            continue;
+        }
+
+        if (room->presence[i].joined != joined) {
+            memmove(&room->presence[i], &room->presence[i + 1],
+                (size_t)(room->presence_count - i - 1) * sizeof(server_presence_change_t));
+            room->presence_count--;
+            server->stats.presence_collapsed += 2;
+        }
+        return;
+    }
+
+    if (room->presence_count == SERVER_PRESENCE_MAX_CHANGES) {
+        server_flush_presence(server, 1);
+    }
+
+    if (room->presence_count == 0) {
+        room->presence_since_ms = utils_clock_now_ms();
+    }
+
+    server_presence_change_t* change = &room->presence[room->presence_count++];
+    utils_string_copy(change->username, sizeof(change->username), username);
+    change->joined = joined;
+}
+
+static void server_flush_presence(chat_server_t* server, int force) {
+    server_room_t* room = &server->room;
+    if (room->presence_count == 0) {
+        return;
+    }
+
+    if (!force && utils_clock_now_ms() - room->presence_since_ms < server->config.presence_window_ms) {
+        return;
+    }
+
+    // ä Ͽ  ȳ â ϳ
+    char notice[256];
+    server_format_presence_notice(room, NULL, notice, sizeof(notice));
+
+    message_t* notice_msg = message_create_chat(0, "System", notice);
+    network_frame_t* notice_frame = notice_msg ? server_record_chat(server, notice_msg) : NULL;
+    message_destroy(notice_msg);
+
+    if (notice_frame) {
+        uint32_t notice_sequence = room->next_sequence - 1;
+
+        for (int c = 0; c < MAX_SERVER_CLIENTS; c++) {
+            client_info_t* client = &server->clients[c];
+            if (!client->is_active || !client->socket || !client->is_authenticated) {
+                continue;
+            }
+
+            if (!server_presence_has_change(room, client->username)) {
+                server_queue_frame(server, client, notice_frame);
+                continue;
+            }
+
+            // ٷ ˸ ó  / ,   纻 
+            // 簳ص Ͽ  ȳ ٽ  ʰ 
+            char own_notice[256];
+            if (server_format_presence_notice(room, client->username, own_notice, sizeof(own_notice)) == 0) {
+                // ڱ ̸  ȳ Ƿ   ū ÷ 
+                server_send_session_token(server, client);
+                continue;
+            }
+
+            message_t* own_msg = message_create_chat(0, "System", own_notice);
+            if (own_msg) {
+                ((chat_message_payload_t*)own_msg->payload)->sequence = htonl(notice_sequence);
+                server_send_to_client(server, client->id, own_msg);
+                message_destroy(own_msg);
+            }
+        }
+    }
+
+    //   ("+a,+b,-c",  ϳ    )
+    network_frame_t* digests[SERVER_PRESENCE_MAX_CHANGES];
+    int digest_count = 0;
+    char digest[MAX_MESSAGE_SIZE - sizeof(message_header_t)];
+    size_t digest_length = 0;
+
+    for (int i = 0; i <= room->presence_count; i++) {
+        size_t entry_length = i < room->presence_count ? strlen(room->presence[i].username) + 2 : 0;
+
+        if (digest_length > 0 && (i == room->presence_count || digest_length + entry_length > sizeof(digest))) {
+            message_t* digest_msg = message_create(MSG_USER_PRESENCE, digest, (uint32_t)digest_length);
+            digests[digest_count] = digest_msg ? network_frame_create(digest_msg) : NULL;
+            message_destroy(digest_msg);
+            if (digests[digest_count]) {
+                digest_count++;
+            }
+            digest_length = 0;
+        }
+
+        if (i == room->presence_count) {
+            break;
+        }
+
+        if (digest_length > 0) {
+            digest[digest_length++] = PRESENCE_DIGEST_SEPARATOR;
+        }
+        digest[digest_length++] = room->presence[i].joined ? PRESENCE_DIGEST_JOINED : PRESENCE_DIGEST_LEFT;
+        memcpy(digest + digest_length, room->presence[i].username, entry_length - 2);
+        digest_length += entry_length - 2;
+    }
+
+    //  𸣴 Ŭ̾ƮԴ 渶    (ʿ    )
+    network_frame_t* legacy[SERVER_PRESENCE_MAX_CHANGES] = { 0 };
+
+    for (int c = 0; c < MAX_SERVER_CLIENTS; c++) {
+        client_info_t* client = &server->clients[c];
+        if (!client->is_active || !client->socket || !client->is_authenticated) {
+            continue;
+        }
+
+        if (client->capabilities & PROTOCOL_CAP_PRESENCE_DIGEST) {
+            for (int d = 0; d < digest_count; d++) {
+                server_queue_frame(server, client, digests[d]);
+            }
+            continue;
+        }
+
+        for (int i = 0; i < room->presence_count; i++) {
+            const server_presence_change_t* change = &room->presence[i];
+            if (strcmp(change->username, client->username) == 0) {
+                continue;  // ڱ  ˸ 
+            }
+
+            if (!legacy[i]) {
+                message_t* presence_msg = message_create(change->joined ? MSG_USER_JOINED : MSG_USER_LEFT,
+                    change->username, (uint32_t)strlen(change->username));
+                legacy[i] = presence_msg ? network_frame_create(presence_msg) : NULL;
+                message_destroy(presence_msg);
+            }
+            if (legacy[i]) {
+                server_queue_frame(server, client, legacy[i]);
+            }
+        }
+    }
+
+    for (int d = 0; d < digest_count; d++) {
+        network_frame_release(digests[d]);
+    }
+    for (int i = 0; i < room->presence_count; i++) {
+        network_frame_release(legacy[i]);
+    }
+
+    server->stats.presence_digests++;
+    room->presence_count = 0;
+}
+
+static int server_presence_has_change(const server_room_t* room, const char* username) {
+    for (int i = 0; i < room->presence_count; i++) {
+        if (strcmp(room->presence[i].username, username) == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int server_format_presence_notice(const server_room_t* room, const char* exclude_username,
+    char* buffer, size_t buffer_size) {
+    //  (ȳ ޴ )   
+    const server_presence_change_t* single = NULL;
+    int count = 0;
+    for (int i = 0; i < room->presence_count; i++) {
+        if (exclude_username && strcmp(room->presence[i].username, exclude_username) == 0) {
+            continue;
+        }
+        single = &room->presence[i];
+        count++;
+    }
 
-    message_t* join_msg = message_create_chat(0, "System", join_message);
-    if (join_msg) {
-        server_broadcast_to_authenticated(server, join_msg, client->id);
-        message_destroy(join_msg);
+    buffer[0] = '\0';
+    if (count == 0) {
+        return 0;
     }
 
-    //   ý ޽
-    message_t* user_joined_msg = message_create(MSG_USER_JOINED, username, strlen(username));
-    if (user_joined_msg) {
-        server_broadcast_to_authenticated(server, user_joined_msg, client->id);
-        message_destroy(user_joined_msg);
+    if (count == 1) {
+        sprintf_s(buffer, buffer_size, single->joined ? "%s has joined the chat" : "%s has left the chat",
+            single->username);
+        return count;
     }
+
+    // "Joined: a, b / Left: c" (ġ "..." )
+    size_t length = 0;
+
+    for (int pass = 1; pass >= 0; pass--) {
+        int listed = 0;
+        for (int i = 0; i < room->presence_count; i++) {
+            if (room->presence[i].joined != pass ||
+                (exclude_username && strcmp(room->presence[i].username, exclude_username) == 0)) {
+                continue;
+            }
+
+            const char* prefix = listed > 0 ? ", " : (pass ? "Joined: " : (length > 0 ? " / Left: " : "Left: "));
+            size_t needed = strlen(prefix) + strlen(room->presence[i].username);
+            if (length + needed + 4 >= buffer_size) {
+                sprintf_s(buffer + length, buffer_size - length, "...");
+                return count;
+            }
+
+            length += sprintf_s(buffer + length, buffer_size - length, "%s%s", prefix, room->presence[i].username);
+            listed++;
+        }
+    }
+
+    return count;
 }
 
 static void server_handle_chat_message(chat_server_t* server, client_info_t* client, message_t* message) {
@@ -1216,14 +2162,7 @@ static void server_handle_chat_message(chat_server_t* server, client_info_t* cli
     }
 
     //  Ȯ
-    if (!client->is_authenticated) {
-        LOG_WARNING("Unauthenticated client %d tried to send chat message", client->id);
-        message_t* error_msg = message_create_error(RESPONSE_AUTH_FAILED,
-            "Authentication required");
-        if (error_msg) {
-            server_send_to_client(server, client->id, error_msg);
-            message_destroy(error_msg);
-        }
+    if (server_require_authentication(server, client) != 0) {
         return;
     }
 
@@ -1234,14 +2173,69 @@ static void server_handle_chat_message(chat_server_t* server, client_info_t* cli
     }
 
     // ޽   ( ü ̷ε带 ؽƮ ó)
-    char* chat_text = (char*)malloc(payload_size + 1);
+    server_publish_user_chat(server, client, message->payload, payload_size, 0);
+}
+
+static void server_handle_chat_submit(chat_server_t* server, client_info_t* client, message_t* message) {
+    if (!server || !client || !message) {
+        return;
+    }
+
+    if (server_require_authentication(server, client) != 0) {
+        return;
+    }
+
+    uint32_t payload_size = ntohl(message->header.payload_size);
+    uint32_t offset = 0;
+    uint32_t message_id;
+    const char* text;
+    uint16_t length;
+
+    // 翬  ٽ  ä ̹  ID  (ID  ȿ )
+    while (message_read_chat_record(message->payload, payload_size, &offset, &message_id, &text, &length) == 0) {
+        if (message_id != 0 && message_id <= client->last_message_id) {
+            LOG_DEBUG("Dropping duplicate chat %u from client %d", message_id, client->id);
+            server->stats.duplicate_chats++;
+            continue;
+        }
+        if (message_id != 0) {
+            client->last_message_id = message_id;
+        }
+
+        server_publish_user_chat(server, client, text, length, message_id);
+    }
+
+    if (offset != payload_size) {
+        LOG_WARNING("Malformed chat submit payload from client %d", client->id);
+        server->stats.protocol_errors++;
+    }
+}
+
+static int server_require_authentication(chat_server_t* server, client_info_t* client) {
+    if (client->is_authenticated) {
+        return 0;
+    }
+
+    LOG_WARNING("Unauthenticated client %d tried to send chat message", client->id);
+    message_t* error_msg = message_create_error(RESPONSE_AUTH_FAILED,
+        "Authentication required");
+    if (error_msg) {
+        server_send_to_client(server, client->id, error_msg);
+        message_destroy(error_msg);
+    }
+    return -1;
+}
+
+static void server_publish_user_chat(chat_server_t* server, client_info_t* client, const char* text,
+    uint32_t length, uint32_t message_id) {
+    char* chat_text = (char*)malloc(length + 1);
     if (!chat_text) {
         LOG_ERROR("Failed to allocate memory for chat message");
         return;
     }
 
-    memcpy(chat_text, message->payload, payload_size);
-    chat_text[payload_size] = '\0';
+    memcpy(chat_text, text, length);
+    chat_text[length] = '\0';
 
     // ޽ ȿ 
     utils_string_trim(chat_text);
@@ -1253,10 +2247,11 @@ static void server_handle_chat_message(chat_server_t* server, client_info_t* cli
 
     LOG_INFO("Chat from %s: %s", client->username, chat_text);
 
-    // εĳƮ ä ޽ 
+    // εĳƮ ä ޽  (߽ڴ ID ڱ ޽  Ȯ)
     message_t* broadcast_msg = message_create_chat(client->id, client->username, chat_text);
     if (broadcast_msg) {
-        int sent_count = server_broadcast_to_authenticated(server, broadcast_msg, 0);  //   
+        ((chat_message_payload_t*)broadcast_msg->payload)->message_id = htonl(message_id);
+        int sent_count = server_publish_chat(server, broadcast_msg, 0);  //   
         LOG_DEBUG("Chat message broadcast to %d clients", sent_count);
         message_destroy(broadcast_msg);
     }
@@ -1296,6 +2291,18 @@ static void server_handle_user_list_request(chat_server_t* server, client_info_t
         }
     }
 
+    // 簳   ڴ  ˸ ̹Ƿ Ͽ 
+    for (int i = 0; i < MAX_SERVER_CLIENTS && offset < sizeof(user_list) - MAX_USERNAME_LENGTH - 2; i++) {
+        const server_detached_session_t* session = &server->detached_sessions[i];
+        if (session->in_use) {
+            if (user_count > 0) {
+                offset += sprintf_s(user_list + offset, sizeof(user_list) - offset, ",");
+            }
+            offset += sprintf_s(user_list + offset, sizeof(user_list) - offset, "%s", session->username);
+            user_count++;
+        }
+    }
+
     if (user_count == 0) {
         utils_string_copy(user_list, sizeof(user_list), "No other users online");
     }
@@ -1314,9 +2321,30 @@ static void server_handle_heartbeat_ack(chat_server_t* server, client_info_t* cl
         return;
     }
 
-    client->last_heartbeat = time(NULL);
-    client->last_activity = time(NULL);
+    // Ȱ ð   ̹ ŵ ( ̵  ȣ)
     LOG_DEBUG("Received heartbeat ACK from client %d", client->id);
+
+    //  Ŭ̾Ʈ ̷ε  
+    if (ntohl(message->header.payload_size) < sizeof(heartbeat_payload_t)) {
+        return;
+    }
+
+    const heartbeat_payload_t* ack = (const heartbeat_payload_t*)message->payload;
+    uint32_t echo_us = ntohl(ack->echo_us);
+    uint32_t timestamp_us = ntohl(ack->timestamp_us);
+
+    if (echo_us != 0) {
+        network_rtt_update(&client->rtt, network_rtt_elapsed_ms(echo_us));
+    }
+
+    // Ŭ̾Ʈ RTT   ֵ Ŭ̾Ʈ ð 
+    if (timestamp_us != 0) {
+        message_t* echo = message_create_heartbeat(MSG_HEARTBEAT_ACK, 0, timestamp_us);
+        if (echo) {
+            server_send_to_client(server, client->id, echo);
+            message_destroy(echo);
+        }
+    }
 }
 
 static void server_handle_disconnect_request(chat_server_t* server, client_info_t* client, message_t* message) {
@@ -1325,6 +2353,7 @@ static void server_handle_disconnect_request(chat_server_t* server, client_info_
     }
 
     LOG_INFO("Client %d requested disconnect", client->id);
+    client->is_leaving = 1;  // 簳 ٸ ʰ ٷ  ˸
 
     //   
     message_t* response = message_create(MSG_DISCONNECT, NULL, 0);
@@ -1335,4 +2364,141 @@ static void server_handle_disconnect_request(chat_server_t* server, client_info_
 
     // Ŭ̾Ʈ  (  ˸ )
     server_remove_client(server, client->id);
-}
\ No newline at end of file
+}
+
+// =============================================================================
+//  簳 (簳 ū, 簳  , ģ ޽ )
+// =============================================================================
+
+static void server_issue_session_token(chat_server_t* server, client_info_t* client) {
+    if (server->config.resume_grace_sec <= 0) {
+        return;
+    }
+
+    // /簳   ū ߱ ( ū ٽ   )
+    if (utils_generate_secure_token(client->resume_token, SESSION_TOKEN_LENGTH) != 0) {
+        LOG_WARNING("Failed to generate resume token for client %d", client->id);
+        client->resume_token[0] = '\0';
+        return;
+    }
+
+    server_send_session_token(server, client);
+}
+
+static void server_send_session_token(chat_server_t* server, client_info_t* client) {
+    if (utils_string_is_empty(client->resume_token)) {
+        return;
+    }
+
+    session_token_payload_t payload = { 0 };
+    utils_string_copy(payload.token, sizeof(payload.token), client->resume_token);
+    payload.last_sequence = htonl(server->room.next_sequence - 1);
+
+    message_t* token_msg = message_create(MSG_SESSION_TOKEN, &payload, sizeof(payload));
+    if (token_msg) {
+        server_send_to_client(server, client->id, token_msg);
+        message_destroy(token_msg);
+    }
+}
+
+static int server_detach_session(chat_server_t* server, client_info_t* client) {
+    if (server->config.resume_grace_sec <= 0 || server->state != SERVER_STATE_RUNNING ||
+        utils_string_is_empty(client->resume_token)) {
+        return -1;
+    }
+
+    for (int i = 0; i < MAX_SERVER_CLIENTS; i++) {
+        server_detached_session_t* session = &server->detached_sessions[i];
+        if (!session->in_use) {
+            session->in_use = 1;
+            utils_string_copy(session->username, sizeof(session->username), client->username);
+            utils_string_copy(session->resume_token, sizeof(session->resume_token), client->resume_token);
+            session->detached_at = utils_clock_now_ms();
+            session->last_message_id = client->last_message_id;
+
+            LOG_INFO("Session '%s' detached, resumable for %d seconds",
+                client->username, server->config.resume_grace_sec);
+            return 0;
+        }
+    }
+
+    return -1;  //    ٷ  ó
+}
+
+static void server_release_detached_username(chat_server_t* server, const char* username) {
+    for (int i = 0; i < MAX_SERVER_CLIENTS; i++) {
+        server_detached_session_t* session = &server->detached_sessions[i];
+        if (session->in_use && strcmp(session->username, username) == 0) {
+            //   Ƿ ߴ  ˸  
+            LOG_INFO("Detached session '%s' replaced by a new login", username);
+            memset(session, 0, sizeof(server_detached_session_t));
+            server_announce_presence(server, username, 0, 0);
+        }
+    }
+}
+
+static int server_expire_detached_sessions(chat_server_t* server, uint64_t now_ms) {
+    uint64_t grace_ms = (uint64_t)server->config.resume_grace_sec * 1000;
+    int expired_count = 0;
+
+    for (int i = 0; i < MAX_SERVER_CLIENTS; i++) {
+        server_detached_session_t* session = &server->detached_sessions[i];
+        if (!session->in_use || now_ms - session->detached_at < grace_ms) {
+            continue;
+        }
+
+        char username[MAX_USERNAME_LENGTH];
+        utils_string_copy(username, sizeof(username), session->username);
+        memset(session, 0, sizeof(server_detached_session_t));
+
+        LOG_INFO("Session '%s' was not resumed in time", username);
+        server_announce_presence(server, username, 0, 0);
+        expired_count++;
+    }
+
+    return expired_count;
+}
+
+static int server_replay_backlog(chat_server_t* server, client_info_t* client, uint32_t last_sequence) {
+    uint32_t next_sequence = server->room.next_sequence;
+    uint32_t oldest_sequence = next_sequence > SERVER_ROOM_BACKLOG_SIZE ?
+        next_sequence - SERVER_ROOM_BACKLOG_SIZE : 1;
+
+    // Ŭ̾Ʈ       
+    if (last_sequence >= next_sequence) {
+        return 0;
+    }
+
+    uint32_t first_sequence = last_sequence + 1;
+    if (first_sequence < oldest_sequence) {
+        char notice[128];
+        sprintf_s(notice, sizeof(notice), "%u earlier messages are no longer available",
+            oldest_sequence - first_sequence);
+
+        message_t* notice_msg = message_create_chat(0, "System", notice);
+        if (notice_msg) {
+            server_send_to_client(server, client->id, notice_msg);
+            message_destroy(notice_msg);
+        }
+        first_sequence = oldest_sequence;
+    }
+
+    int replayed = 0;
+    for (uint32_t sequence = first_sequence; sequence < next_sequence; sequence++) {
+        network_frame_t* frame = server->room.frames[sequence % SERVER_ROOM_BACKLOG_SIZE];
+        if (!frame) {
+            continue;
+        }
+        if (server_queue_frame(server, client, frame) != 0) {
+            break;  // ۽ ť ħ
+        }
+        replayed++;
+    }
+
+    if (replayed > 0) {
+        LOG_INFO("Replayed %d missed messages to client %d", replayed, client->id);
+        server->stats.messages_replayed += replayed;
+    }
+
+    return replayed;
+}
@@ -6,6 +6,8 @@
 #include "message.h"
 #include "network.h"
 #include "utils.h"
+#include "trace.h"
+#include "capture.h"
 
 #include <time.h>
 
@@ -19,6 +21,20 @@
 #define HEARTBEAT_INTERVAL_SEC      30          // ƮƮ  ()
 #define CLIENT_TIMEOUT_SEC          60          // Ŭ̾Ʈ ŸӾƿ ()
 #define SERVER_SHUTDOWN_TIMEOUT_MS  5000        //   ŸӾƿ
+#define SERVER_RESUME_GRACE_SEC     30          //    簳  ִ ð ()
+#define SERVER_ROOM_BACKLOG_SIZE    256         // 簳 Ŭ̾Ʈ ٽ  ֱ ä 
+#define SERVER_FULL_RETRY_AFTER_SEC 10          // ȭ  ˷ ּ õ  (, ִ 2 л)
+#define SERVER_LISTEN_BACKLOG       1024        // ⺻  ⿭ ũ (翬  )
+#define SERVER_ACCEPT_BUDGET        64          //     ִ  
+#define SERVER_ZEROCOPY_POLL_MS     1           //  ī  ϷḦ ٸ   select ŸӾƿ
+#define SERVER_ZEROCOPY_POLL_MAX_MS 64          // Ϸᰡ    辿 ø Ȯ  
+#define SERVER_COMPRESSION_THRESHOLD 256        //   ῡ  ũ ̻  ؼ 
+#define SERVER_BATCH_MAX_FRAMES     64          //   ϳ  ִ  
+#define SERVER_BATCH_CACHE_SIZE     4           //  ܰ  ڳ   ִ  
+#define SERVER_PRESENCE_WINDOW_MS   250         // /   ϳ   (и)
+#define SERVER_PRESENCE_MAX_CHANGES 256         //     ִ /  (ġ ٷ )
+#define SERVER_DRAIN_TIMEOUT_MS     5000        // ۽ ť   ä ƿ  ִ ⺻ ð
+#define SERVER_DRAIN_RTO_FACTOR     8           //  ð  RTT   (Ȱ RTT + 4 *  )
 
 // =============================================================================
 //     ü
@@ -43,6 +59,18 @@ typedef struct {
     int client_timeout_sec;         // Ŭ̾Ʈ ŸӾƿ
     log_level_t log_level;          // α 
     int enable_heartbeat;           // ƮƮ Ȱȭ 
+    char trace_file[MAX_PATH];      // ̳ʸ Ʈ̽  ( ڿ̸ Ȱȭ)
+    uint32_t trace_capacity;        // Ʈ̽   ڵ 
+    char capture_file[MAX_PATH];    //  Ʈ ĸó  ( ڿ̸ Ȱȭ)
+    int resume_grace_sec;           //  簳  ð (0̸ 簳 Ȱȭ)
+    int listen_backlog;             //  ⿭ ũ
+    int tcp_nodelay;                // Ŭ̾Ʈ ῡ TCP_NODELAY  (Nagle  )
+    int batch_writes;               //     ⸦ Ҵٰ     (0̸ Ӹ  )
+    uint32_t zerocopy_threshold;    //    Ʈ ̻   ī  (0̸ Ȱȭ)
+    int enable_compression;         // Ŭ̾Ʈ ûϸ   
+    uint32_t compression_threshold; //  ּ  ũ
+    int enable_compact_header;      // Ŭ̾Ʈ ûϸ α    
+    uint32_t presence_window_ms;    // /   (0̸ ٷ ˸)
 } server_config_t;
 
 // Ŭ̾Ʈ  ü
@@ -51,21 +79,71 @@ typedef struct {
     network_socket_t* socket;       // Ʈũ 
     char username[MAX_USERNAME_LENGTH]; // ڸ
     time_t connected_at;            //  ð
-    time_t last_activity;           //  Ȱ ð
-    time_t last_heartbeat;          //  ƮƮ ð
+    uint64_t last_activity;         //    ð (ƮƮ   ۽ŵ )
+    uint64_t last_heartbeat;        //  ƮƮ  ð
+    uint64_t heartbeat_due;         //   θ Ȯ ð (Ḷ л)
 
     //  
     int is_authenticated;           //  Ϸ 
     int is_active;                  // Ȱ  
+    int is_leaving;                 //   û (簳    ó)
+    char resume_token[SESSION_TOKEN_LENGTH + 1]; // ߱  簳 ū
+    uint32_t last_message_id;       //   ä ID (۵ ä ߺ )
+
+    // ۽ (    )
+    network_send_queue_t send_queue; //   ť
+    int is_overflowed;              // ť    ܰ迡   Ŭ̾Ʈ
+    LONGLONG pending_since;         //  ִ ť ù   ð (QueryPerformanceCounter)
+    uint32_t capabilities;          //    (PROTOCOL_CAP_*)
+    network_rtt_t rtt;              // ƮƮ պ  RTT ( Ʈũ  Һ )
+
+    // ̹     (  Ḹ,   MSG_BATCH ϳ  ť )
+    network_frame_t* batch_frames[SERVER_BATCH_MAX_FRAMES];
+    int batch_count;
+    uint32_t batch_bytes;           //   ̷ε ũ
 
     //  
     uint32_t messages_sent;         //  ޽ 
     uint32_t messages_received;     //  ޽ 
 } client_info_t;
 
+//   簳 ٸ  ( ð   ˸ )
+typedef struct {
+    int in_use;                     //   
+    char username[MAX_USERNAME_LENGTH]; // ڸ
+    char resume_token[SESSION_TOKEN_LENGTH + 1]; // 簳 ū
+    uint64_t detached_at;           //   ð
+    uint32_t last_message_id;       //   ä ID (簳 Ŀ ߺ  )
+} server_detached_session_t;
+
+//  ˸  / (     )
+typedef struct {
+    char username[MAX_USERNAME_LENGTH]; // ڸ
+    int joined;                     // ̸ 1, ̸ 0
+} server_presence_change_t;
+
+// ̹  ܰ迡   (    ڴ    ົ )
+typedef struct {
+    network_frame_t* batch;         //   (NULL̸  ׸)
+    network_frame_t* frames[SERVER_BATCH_MAX_FRAMES]; //    (  ξ ּҰ  )
+    int count;
+} server_batch_cache_t;
+
+// äù ֱ ޽  ( % SERVER_ROOM_BACKLOG_SIZE ġ )
+typedef struct {
+    network_frame_t* frames[SERVER_ROOM_BACKLOG_SIZE]; //  Ű εĳƮ  (۽ ť )
+    uint32_t next_sequence;         //  ű  (1)
+
+    // /  (presence_window_ms   ˸)
+    server_presence_change_t presence[SERVER_PRESENCE_MAX_CHANGES];
+    int presence_count;
+    uint64_t presence_since_ms;     // ù    ð
+} server_room_t;
+
 //   ü
 typedef struct {
     time_t start_time;              //   ð
+    uint64_t start_ms;              //   ð ( ð )
     uint32_t total_connections;     //   
     uint32_t current_connections;   //   
     uint32_t max_concurrent_connections; // ִ   
@@ -74,6 +152,29 @@ typedef struct {
     uint64_t total_bytes_received;  //   Ʈ
     uint32_t authentication_failures; //   Ƚ
     uint32_t protocol_errors;       //   Ƚ
+    uint32_t rejected_connections;  // ȭ ¶   
+    uint32_t sessions_resumed;      // 簳  
+    uint32_t messages_replayed;     // 簳  ٽ  ä 
+    uint32_t duplicate_chats;       // ̹  ID  ä 
+    uint64_t frames_flushed;        // ۽ Ϸ  
+    uint64_t send_calls;            // ۽ ý ȣ  (    ȿ Ȯ)
+    uint32_t slow_consumers;        // ۽ ť   Ŭ̾Ʈ 
+    uint64_t segments_estimated;    //  TCP ׸Ʈ  (MSS )
+    uint32_t zerocopy_sends;        //  īǷ   
+    uint64_t compressed_frames;     // ົ    ( )
+    uint64_t compression_saved_bytes; //   ۽ Ʈ
+    uint64_t batches_sent;          //    
+    uint64_t frames_batched;        //     
+    uint64_t batches_shared;        // ٸ ڰ   ״  Ƚ
+    uint32_t presence_changes;      //  / 
+    uint32_t presence_collapsed;    //  Ǿ ˸  / 
+    uint32_t presence_digests;      //  /   (â )
+    uint64_t heartbeats_sent;       //  ƮƮ  ( Ḹ)
+    uint64_t heartbeats_elided;     // ֱ  ־ (Ǵ ť з ־)  ƮƮ 
+    uint32_t lagging_consumers;     // ۽ ť RTT  ð ȿ  ʾ  Ŭ̾Ʈ 
+    uint64_t flush_latency_samples; // ť   Ƚ
+    double flush_latency_total_us;  // ù    ť   ɸ ð հ
+    double flush_latency_max_us;    //  ð ִ
 } server_statistics_t;
 
 // =============================================================================
@@ -93,14 +194,26 @@ typedef struct {
     int client_count;               //  Ŭ̾Ʈ 
     uint32_t next_client_id;        //  Ŭ̾Ʈ ID
 
+    //  簳
+    server_detached_session_t detached_sessions[MAX_SERVER_CLIENTS]; // 簳  
+    server_room_t room;             // äù   ֱ ޽
+
     // select  ũ 
     fd_set master_read_fds;         //  б FD 
     fd_set working_read_fds;        // ۾ б FD 
+    fd_set master_write_fds;        //  Ͱ   (  )
+    fd_set working_write_fds;       // ۾  FD 
     SOCKET max_fd;                  // ִ  ũ
+    LARGE_INTEGER perf_frequency;   // ۽   QueryPerformanceCounter ļ
+    int zerocopy_pending;           // ϷḦ ٸ  ī  ִ  
+    int zerocopy_poll_ms;           //  ī Ϸ Ȯ  (Ϸᰡ  þ ϷǸ ó)
+    compress_context_t* compressor; // ۽   ؽƮ (Ӹ   )
+    server_batch_cache_t batch_cache[SERVER_BATCH_CACHE_SIZE]; //  ܰ  ϴ 
+    int batch_cache_next;           //    ĳ ׸
 
-    // ð 
-    time_t last_heartbeat_check;    //  ƮƮ üũ ð
-    time_t last_cleanup;            //   ۾ ð
+    // ð  (time_t  ð ǥÿ̰, ŸӾƿ  и   ð utils_clock_now_ms )
+    uint64_t last_heartbeat_check;  //  ƮƮ üũ ð
+    uint64_t last_cleanup;          //   ۾ ð
 
     //   ͸
     server_statistics_t stats;      //  
@@ -209,7 +322,7 @@ int server_get_active_client_count(const chat_server_t* server);
 // =============================================================================
 
 /**
- * Ư Ŭ̾Ʈ ޽ 
+ * Ư Ŭ̾Ʈ ޽  (۽ ť ְ   )
  * @param server  νϽ
  * @param client_id  Ŭ̾Ʈ ID
  * @param message  ޽
@@ -226,6 +339,15 @@ int server_send_to_client(chat_server_t* server, uint32_t client_id, const messa
  */
 int server_broadcast_message(chat_server_t* server, const message_t* message, uint32_t exclude_client_id);
 
+/**
+ * äù ޽  ( ű ֱ ޽    Ŭ̾Ʈ εĳƮ)
+ * @param server  νϽ
+ * @param message MSG_CHAT_BROADCAST ޽ ( ʵ尡 ä)
+ * @param exclude_client_id  Ŭ̾Ʈ ID
+ * @return   Ŭ̾Ʈ 
+ */
+int server_publish_chat(chat_server_t* server, message_t* message, uint32_t exclude_client_id);
+
 /**
  *  Ŭ̾ƮԸ ޽ εĳƮ
  * @param server  νϽ
@@ -240,19 +362,27 @@ int server_broadcast_to_authenticated(chat_server_t* server, const message_t* me
 // =============================================================================
 
 /**
- * Ȱ Ŭ̾Ʈ 
+ * Ȱ Ŭ̾Ʈ   ð  簳   
  * @param server  νϽ
  * @return  Ŭ̾Ʈ 
  */
 int server_cleanup_inactive_clients(chat_server_t* server);
 
 /**
- * ƮƮ Ȯ  
+ * ƮƮ Ȯ   (    ƮƮ   ƹ͵   Ḹ)
  * @param server  νϽ
- * @return ó Ŭ̾Ʈ 
+ * @return ƮƮ  Ŭ̾Ʈ 
  */
 int server_check_heartbeats(chat_server_t* server);
 
+/**
+ *  Ŭ̾Ʈ ۽ ť  (Ḷ WSASend    )
+ * ų ť ģ Ŭ̾Ʈ ⼭ ŵ
+ * @param server  νϽ
+ * @return ŵ Ŭ̾Ʈ 
+ */
+int server_flush_clients(chat_server_t* server);
+
 /**
  * FD  Ʈ (select)
  * @param server  νϽ
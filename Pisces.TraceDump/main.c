@@ -0,0 +1,321 @@
+#include "common_headers.h"
+#include "message.h"
+#include "trace.h"
+#include "utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// =============================================================================
+// α׷ 
+// =============================================================================
+
+#define PROGRAM_NAME        "Trace Dump"
+#define PROGRAM_VERSION     "1.0.0"
+
+#define MAX_TRACKED_TYPES   64          //  踦  ޽ Ÿ 
+
+// =============================================================================
+//  ɼ    ü
+// =============================================================================
+
+typedef struct {
+    int show_help;              //  ǥ
+    int summary_only;           // ̺Ʈ   ุ 
+    uint32_t conn_filter;       // Ư Ḹ  (0̸ ü)
+    const char* trace_file;     // Ʈ̽  
+} dump_args_t;
+
+typedef struct {
+    uint16_t msg_type;          // ޽ Ÿ
+    uint32_t frames_received;   //   
+    uint64_t bytes_received;    //  Ʈ
+    uint32_t frames_flushed;    // ۽ Ϸ  
+    uint64_t bytes_flushed;     // ۽ Ʈ
+    uint32_t handler_count;     // ó Ƚ
+    double handler_total_us;    // ó ð հ
+    double handler_max_us;      // ִ ó ð
+} type_summary_t;
+
+// =============================================================================
+// Լ 
+// =============================================================================
+
+static void print_usage(const char* program_name);
+static int parse_arguments(int argc, char* argv[], dump_args_t* args);
+static trace_file_header_t* load_trace_file(const char* filename);
+static type_summary_t* find_type_summary(type_summary_t* table, int* count, uint16_t msg_type);
+static double ticks_to_ms(const trace_file_header_t* header, uint64_t ticks);
+
+// =============================================================================
+//  Լ
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    dump_args_t args;
+    if (parse_arguments(argc, argv, &args) != 0) {
+        return EXIT_FAILURE;
+    }
+
+    if (args.show_help) {
+        print_usage(argv[0]);
+        return EXIT_SUCCESS;
+    }
+
+    trace_file_header_t* header = load_trace_file(args.trace_file);
+    if (!header) {
+        return EXIT_FAILURE;
+    }
+
+    const trace_record_t* records = (const trace_record_t*)(header + 1);
+
+    //    ̻    ڵ 
+    uint64_t retained = header->write_index < header->capacity ?
+        header->write_index : header->capacity;
+    uint64_t first_index = header->write_index - retained;
+
+    type_summary_t type_table[MAX_TRACKED_TYPES];
+    int type_count = 0;
+    uint32_t event_counts[TRACE_EVENT_COUNT] = { 0 };
+
+    //     ̹Ƿ HANDLER_START  HANDLER_END ¦ 
+    uint64_t pending_start_ticks = 0;
+    uint32_t pending_conn = 0;
+    int has_pending_start = 0;
+
+    uint64_t first_ticks = 0;
+    uint64_t last_ticks = 0;
+    int has_events = 0;
+
+    if (!args.summary_only) {
+        printf("%12s  %-6s %-14s %-24s %s\n", "TIME(ms)", "CONN", "EVENT", "MESSAGE", "SIZE");
+    }
+
+    for (uint64_t i = first_index; i < header->write_index; i++) {
+        const trace_record_t* record = &records[i % header->capacity];
+
+        if (args.conn_filter != 0 && record->conn_id != args.conn_filter) {
+            continue;
+        }
+
+        if (!has_events) {
+            first_ticks = record->ticks;
+            has_events = 1;
+        }
+        if (record->ticks > last_ticks) {
+            last_ticks = record->ticks;
+        }
+
+        if (record->event < TRACE_EVENT_COUNT) {
+            event_counts[record->event]++;
+        }
+
+        type_summary_t* summary = NULL;
+        if (record->msg_type != 0) {
+            summary = find_type_summary(type_table, &type_count, record->msg_type);
+        }
+
+        switch (record->event) {
+        case TRACE_EVENT_FRAME_RECV:
+            if (summary) {
+                summary->frames_received++;
+                summary->bytes_received += record->size;
+            }
+            break;
+
+        case TRACE_EVENT_HANDLER_START:
+            pending_start_ticks = record->ticks;
+            pending_conn = record->conn_id;
+            has_pending_start = 1;
+            break;
+
+        case TRACE_EVENT_HANDLER_END:
+            if (has_pending_start && pending_conn == record->conn_id && summary) {
+                double elapsed_us = ticks_to_ms(header, record->ticks - pending_start_ticks) * 1000.0;
+                summary->handler_count++;
+                summary->handler_total_us += elapsed_us;
+                if (elapsed_us > summary->handler_max_us) {
+                    summary->handler_max_us = elapsed_us;
+                }
+            }
+            has_pending_start = 0;
+            break;
+
+        case TRACE_EVENT_WRITE_FLUSHED:
+            if (summary) {
+                summary->frames_flushed++;
+                summary->bytes_flushed += record->size;
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        if (!args.summary_only) {
+            printf("%12.3f  %-6u %-14s %-24s %u\n",
+                ticks_to_ms(header, record->ticks),
+                record->conn_id,
+                trace_event_to_string((trace_event_t)record->event),
+                record->msg_type != 0 ? message_type_to_string((message_type_t)record->msg_type) : "-",
+                record->size);
+        }
+    }
+
+    //  
+    char start_time[TIME_STRING_SIZE];
+    utils_time_to_string((time_t)(header->start_time_ms / 1000), start_time, sizeof(start_time));
+
+    printf("\n=== Trace Summary ===\n");
+    printf("File: %s\n", args.trace_file);
+    printf("Started: %s\n", start_time);
+    printf("Events recorded: %llu (retained: %llu, overwritten: %llu)\n",
+        header->write_index, retained, first_index);
+    printf("Time span: %.3f ms\n", ticks_to_ms(header, last_ticks - first_ticks));
+    if (args.conn_filter != 0) {
+        printf("Connection filter: %u\n", args.conn_filter);
+    }
+
+    printf("\nEvents:\n");
+    for (int e = TRACE_EVENT_ACCEPT; e < TRACE_EVENT_COUNT; e++) {
+        printf("  %-14s %u\n", trace_event_to_string((trace_event_t)e), event_counts[e]);
+    }
+
+    if (type_count > 0) {
+        printf("\n%-24s %8s %10s %8s %10s %10s %10s\n",
+            "MESSAGE", "RECV", "RECV_B", "SENT", "SENT_B", "AVG_us", "MAX_us");
+        for (int t = 0; t < type_count; t++) {
+            const type_summary_t* summary = &type_table[t];
+            double average_us = summary->handler_count > 0 ?
+                summary->handler_total_us / summary->handler_count : 0.0;
+
+            printf("%-24s %8u %10llu %8u %10llu %10.1f %10.1f\n",
+                message_type_to_string((message_type_t)summary->msg_type),
+                summary->frames_received,
+                summary->bytes_received,
+                summary->frames_flushed,
+                summary->bytes_flushed,
+                average_us,
+                summary->handler_max_us);
+        }
+    }
+
+    free(header);
+    return EXIT_SUCCESS;
+}
+
+// =============================================================================
+//   μ Ľ
+// =============================================================================
+
+static void print_usage(const char* program_name) {
+    printf("%s v%s\n\n", PROGRAM_NAME, PROGRAM_VERSION);
+    printf("Usage: %s [OPTIONS] <trace-file>\n\n", program_name);
+    printf("Decodes a binary trace recorded with 'server --trace <file>'.\n\n");
+
+    printf("OPTIONS:\n");
+    printf("  -s, --summary           Print summary only (no event list)\n");
+    printf("  -c, --conn <id>         Only show events of one connection\n");
+    printf("  -h, --help              Show this help message\n");
+}
+
+static int parse_arguments(int argc, char* argv[], dump_args_t* args) {
+    args->show_help = 0;
+    args->summary_only = 0;
+    args->conn_filter = 0;
+    args->trace_file = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+
+        if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
+            args->show_help = 1;
+            return 0;
+        }
+        else if (strcmp(arg, "-s") == 0 || strcmp(arg, "--summary") == 0) {
+            args->summary_only = 1;
+        }
+        else if (strcmp(arg, "-c") == 0 || strcmp(arg, "--conn") == 0) {
+            if (i + 1 >= argc) {
+                LOG_ERROR("Option %s requires a connection id", arg);
+                return -1;
+            }
+            args->conn_filter = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (arg[0] == '-') {
+            LOG_ERROR("Unknown option: %s", arg);
+            LOG_ERROR("Use -h or --help for usage information");
+            return -1;
+        }
+        else {
+            args->trace_file = arg;
+        }
+    }
+
+    if (!args->trace_file) {
+        LOG_ERROR("No trace file specified");
+        LOG_ERROR("Use -h or --help for usage information");
+        return -1;
+    }
+
+    return 0;
+}
+
+// =============================================================================
+// Ʈ̽  ó
+// =============================================================================
+
+static trace_file_header_t* load_trace_file(const char* filename) {
+    FILE* file = NULL;
+    if (fopen_s(&file, filename, "rb") != 0 || !file) {
+        LOG_ERROR("Cannot open trace file: %s", filename);
+        return NULL;
+    }
+
+    trace_file_header_t header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || !trace_validate_header(&header)) {
+        LOG_ERROR("Not a valid trace file: %s", filename);
+        fclose(file);
+        return NULL;
+    }
+
+    size_t records_size = (size_t)header.capacity * sizeof(trace_record_t);
+    trace_file_header_t* buffer = (trace_file_header_t*)malloc(sizeof(header) + records_size);
+    if (!buffer) {
+        LOG_ERROR("Failed to allocate %zu bytes for trace records", records_size);
+        fclose(file);
+        return NULL;
+    }
+
+    *buffer = header;
+    if (fread(buffer + 1, 1, records_size, file) != records_size) {
+        LOG_ERROR("Trace file is truncated: %s", filename);
+        free(buffer);
+        fclose(file);
+        return NULL;
+    }
+
+    fclose(file);
+    return buffer;
+}
+
+static type_summary_t* find_type_summary(type_summary_t* table, int* count, uint16_t msg_type) {
+    for (int i = 0; i < *count; i++) {
+        if (table[i].msg_type == msg_type) {
+            return &table[i];
+        }
+    }
+
+    if (*count >= MAX_TRACKED_TYPES) {
+        return NULL;
+    }
+
+    type_summary_t* summary = &table[(*count)++];
+    memset(summary, 0, sizeof(type_summary_t));
+    summary->msg_type = msg_type;
+    return summary;
+}
+
+static double ticks_to_ms(const trace_file_header_t* header, uint64_t ticks) {
+    return (double)ticks * 1000.0 / (double)header->ticks_per_second;
+}